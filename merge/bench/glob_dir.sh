@@ -0,0 +1,31 @@
+#!/bin/bash
+# 항목 10만개인 디렉토리에서 glob
+# 한 줄에 패턴 넷 (readdir 캐시로 디렉토리를 한번만 읽음) vs 줄마다 하나씩, bash와 비교
+# 사용법: bench/glob_dir.sh [파일 수]
+
+cd "$(dirname "$0")/.." || exit 1
+MS=$PWD/minishell
+N=${1:-100000}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+mkdir "$tmp/d"
+(cd "$tmp/d" && seq -f "f%g.c" "$N" | xargs touch && seq -f "h%g.h" 1000 | xargs touch)
+cat > "$tmp/line.sh" <<'END'
+printf '%s\n' *.h f9*.c f1?.c *[0-4].c | wc -l > /dev/stderr
+END
+cat > "$tmp/lines.sh" <<'END'
+printf '%s\n' *.h | wc -l > /dev/stderr
+printf '%s\n' f9*.c | wc -l > /dev/stderr
+printf '%s\n' f1?.c | wc -l > /dev/stderr
+printf '%s\n' *[0-4].c | wc -l > /dev/stderr
+END
+
+TIMEFORMAT="  %R s"
+echo "glob_dir: $N + 1000 entries"
+for f in line lines; do
+	for sh in "$MS" bash; do
+		echo " $f.sh ($(basename "$sh"))"
+		time (cd "$tmp/d" && "$sh" < "$tmp/$f.sh" 2>&1 >/dev/null | sed 's/^/  /')
+	done
+done
@@ -0,0 +1,22 @@
+#!/bin/bash
+# 본문이 빈 명령(:)인 for 루프를 N번 돌려서 한 번 도는 데 드는 비용을 봄
+# 트리는 한번만 파싱되고 반복마다 확장만 다시 함, bash와 비교
+# 사용법: bench/loop_noop.sh [반복 횟수]
+
+cd "$(dirname "$0")/.." || exit 1
+MS=$PWD/minishell
+N=${1:-1000000}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/loop.sh" <<END
+for i in {1..$N}; do :; done
+echo \$i >&2
+END
+
+TIMEFORMAT="  %R s"
+echo "loop_noop: $N iterations"
+for sh in "$MS" bash; do
+	echo " $(basename "$sh")"
+	time "$sh" "$tmp/loop.sh" 2>&1 >/dev/null | sed 's/^/  /'
+done
@@ -0,0 +1,34 @@
+#!/bin/bash
+# ${v##*/} ${v%/*} ${v//o/0} ${#v}를 minishell 안에서 계산하는 것과
+# 같은 일을 basename/dirname/sed/wc로 fork해서 하는 것을 비교
+# 같은 줄을 N번 넣은 입력을 stdin으로 실행
+# 사용법: bench/param_expand.sh [반복 횟수]
+
+cd "$(dirname "$0")/.." || exit 1
+N=${1:-2000}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+{
+	echo 'export p=/usr/local/lib/libfoo.so.1'
+	for ((i = 0; i < N; i++)); do
+		echo 'export b=${p##*/} d=${p%/*} s=${p//o/0} n=${#p}'
+	done
+	echo 'printf "%s\n" "$b $d $s $n" > /dev/stderr'
+} > "$tmp/inproc.sh"
+{
+	echo 'export p=/usr/local/lib/libfoo.so.1'
+	for ((i = 0; i < N; i++)); do
+		echo 'basename $p'
+		echo 'dirname $p'
+		echo 'echo $p | sed s/o/0/g'
+		echo 'printf %s $p | wc -c'
+	done
+} > "$tmp/fork.sh"
+
+TIMEFORMAT="  %R s"
+echo "param_expand: $N lines x 4 operations"
+for f in inproc fork; do
+	echo " $f"
+	time ./minishell < "$tmp/$f.sh" 2>&1 >/dev/null | sed 's/^/  /'
+done
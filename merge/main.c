@@ -4,37 +4,35 @@
 #include "list.h"
 #include "utils.h"
 #include "output.h"
+#include "print.h"
+#include "script.h"
 
 int	g_exit_status = 0;
 
 //파싱부에서 실행부쪽으로 안넘어가는 상황은 token_lst를 NULL로 세팅합니다.
+//-c, 스크립트 파일, tty가 아닌 stdin은 readline 없이 버퍼에서 읽음 (ready_script)
 int	main(int ac, char **av, char **envp)
 {
 	t_prompt	prompt;
 	t_shell		shell;
-	int			exit_status;
+	t_script	script;
 
-	if (ac != 1 || !av || ready_minishell(&prompt, &shell, envp) == 0)
+	if (!av || ready_minishell(&prompt, &shell, envp) == 0)
 		return (-1);
-	while (!shell.exit_flag)
-	{
-		if (input_process(&prompt) == 0)
-			break ;
-		if (prompt.token_lst)
-			g_exit_status = 0;
-		exit_status = output_process(&shell, &prompt);
-		free(prompt.input);
-		prompt.input = NULL;
-		clear_token_list(&prompt.token_lst);
-		clear_hd_list(&prompt.hd_lst);
-	}
-	cleanup_shell(&shell);
+	if (ready_script(&shell, &script, ac, av))
+		while (!shell.exit_flag && input_process(&prompt))
+			run_line(&shell, &prompt);
+	report_stats(&shell);
 	if (prompt.token_lst || prompt.input)
 	{
-		free(prompt.input);
+		if (!shell.script)
+			free(prompt.input);
 		clear_token_list(&prompt.token_lst);
 		clear_envp_list(&prompt.envp_lst);
 		clear_hd_list(&prompt.hd_lst);
 	}
-	return (exit_status);
+	if (shell.script)
+		script_close(shell.script);
+	cleanup_shell(&shell);
+	return (g_exit_status);
 }
@@ -17,6 +17,6 @@
 
 void	print_tokens(t_token *tokens, char *step);
 void	print_herdocs(t_hd *hd_lst);
-void	print_cmd_list(t_cmd *head);
+void	print_pipeline(t_pipeline *pl);
 
 #endif
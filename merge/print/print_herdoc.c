@@ -28,6 +28,7 @@ void    print_herdocs(t_hd *hd_lst)
 				buf[n] = '\0';
 				printf("%s", buf);
 			}
+			lseek(hd_lst->fd, 0, SEEK_SET);
 			printf("\n----------------------------\n");
 			hd_lst = hd_lst->next;
 		}
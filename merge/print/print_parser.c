@@ -2,43 +2,47 @@
 #include <stdlib.h>
 #include "print.h"
 
-// t_filename 구조체 출력 함수
-void print_filename(t_filename *filename, int index)
+static const char *redir_symbol(t_token_type type)
 {
-    if (!filename)
-    {
-        printf("  FILENAME[%d]: NULL\n", index);
-        return;
-    }
-    
-    printf("  FILENAME[%d]:\n", index);
-    printf("    filename: %s\n", filename->filename ? filename->filename : "NULL");
-    printf("    flag: %s\n", filename->flag ? "CORRECT" : "WRONG");
+    if (type == T_REDIR_IN)
+        return ("<");
+    if (type == T_REDIR_OUT)
+        return (">");
+    if (type == T_APPEND)
+        return (">>");
+    if (type == T_HEREDOC)
+        return ("<<");
+    if (type == T_HERESTRING)
+        return ("<<<");
+    if (type == T_DUP_IN)
+        return ("<&");
+    if (type == T_DUP_OUT)
+        return (">&");
+    return ("?");
 }
 
-void	print_output_file_list(t_filename *head)
+// 리다이렉션 op 배열 출력 함수 (명령줄 순서 그대로)
+void	print_redirs(t_redir *redirs, int count)
 {
-	t_filename	*current;
-	int			index;
+	int	i;
 
-	if (!head)
+	if (count == 0)
 	{
-		printf("  output_file list: EMPTY\n");
+		printf("  redirs: EMPTY\n");
 		return ;
 	}
-	
-	printf("  output_file list:\n");
-	current = head;
-	index = 0;
-	while (current)
+	printf("  redirs:\n");
+	i = 0;
+	while (i < count)
 	{
-		printf("  [%d] filename: \"%s\", flag: %d (%s), append_mode: %d\n", 
-			   index, 
-			   current->filename ? current->filename : "NULL",
-			   current->flag,
-			   current->flag ? "WRONG" : "CORRECT", current->append_mode);
-		current = current->next;
-		index++;
+		if (redirs[i].type == T_HEREDOC)
+			printf("  [%d] %s fd: %d\n", i, redir_symbol(redirs[i].type),
+				redirs[i].fd);
+		else
+			printf("  [%d] %s \"%s\", flag: %d (%s)\n", i,
+				redir_symbol(redirs[i].type), redirs[i].filename,
+				redirs[i].flag, redirs[i].flag ? "WRONG" : "CORRECT");
+		i++;
 	}
 }
 
@@ -65,46 +69,15 @@ void print_cmd(t_cmd *cmd, int index)
         printf("  ]\n");
     }
     
-// input_file 출력 (44번째 줄 근처)
-    printf("  input_file: ");
-    if (cmd->input_file)
-        printf("filename=\"%s\", flag=%s\n", 
-            cmd->input_file->filename ? cmd->input_file->filename : "NULL",
-            cmd->input_file->flag ? "WRONG" : "CORRECT");
-    else
-        printf("NULL\n");
-
-    // output_file 출력 (48번째 줄 근처)
-    printf("  output_file: \n");
-    if (cmd->output_file)
-        print_output_file_list(cmd->output_file);
-    else
-        printf("NULL\n");
-    
-    // hd (파일 디스크립터) 출력
-    printf("  hd (file descriptor): %d", cmd->hd);
-    if (cmd->hd == -1)
-        printf(" (INVALID/CLOSED)");
-    else if (cmd->hd == 0)
-        printf(" (STDIN)");
-    else if (cmd->hd == 1)
-        printf(" (STDOUT)");
-    else if (cmd->hd == 2)
-        printf(" (STDERR)");
-    else if (cmd->hd > 2)
-        printf(" (CUSTOM FD)");
-    printf("\n");
-    
-    // next 포인터 상태
-    printf("  next: %s\n", cmd->next ? "EXISTS" : "NULL");
-    
+    // 리다이렉션 출력
+    print_redirs(cmd->redirs, cmd->redir_count);
     printf("\n");
 }
 
-// 전체 cmd 리스트 출력 함수
-void print_cmd_list(t_cmd *head)
+// 전체 파이프라인 출력 함수
+void print_pipeline(t_pipeline *pl)
 {
-    if (!head)
+    if (!pl)
     {
         printf("CMD LIST: EMPTY\n");
         return;
@@ -112,83 +85,33 @@ void print_cmd_list(t_cmd *head)
     
     printf("========== CMD LIST DEBUG ==========\n");
     
-    t_cmd *current = head;
-    int index = 0;
+    for (int i = 0; i < pl->cmd_count; i++)
+        print_cmd(&pl->cmds[i], i);
     
-    while (current)
-    {
-        print_cmd(current, index);
-        current = current->next;
-        index++;
-    }
-    
-    printf("Total commands: %d\n", index);
+    printf("Total commands: %d, redirections: %d\n",
+        pl->cmd_count, pl->redir_count);
     printf("====================================\n");
 }
 
 // 간단한 요약 출력 함수 (한 줄로)
-void print_cmd_summary(t_cmd *head)
+void print_cmd_summary(t_pipeline *pl)
 {
-    if (!head)
+    if (!pl)
     {
         printf("CMD SUMMARY: EMPTY\n");
         return;
     }
     
     printf("CMD SUMMARY: ");
-    t_cmd *current = head;
-    int index = 0;
-    
-    while (current)
+    for (int i = 0; i < pl->cmd_count; i++)
     {
-        printf("[%d]", index);
-        if (current->args && current->args[0])
-            printf("(%s)", current->args[0]);
-        if (current->input_file && current->input_file->filename)
-            printf("<");
-        if (current->hd > 2)  // 표준 fd가 아닌 경우
-            printf("[fd:%d]", current->hd);
-        
-        if (current->next)
+        printf("[%d]", i);
+        if (pl->cmds[i].args && pl->cmds[i].args[0])
+            printf("(%s)", pl->cmds[i].args[0]);
+        for (int j = 0; j < pl->cmds[i].redir_count; j++)
+            printf("%s", redir_symbol(pl->cmds[i].redirs[j].type));
+        if (i + 1 < pl->cmd_count)
             printf(" -> ");
-        
-        current = current->next;
-        index++;
     }
     printf("\n");
 }
-
-// 파일 디스크립터만 따로 확인하는 함수
-void print_cmd_fd_info(t_cmd *head)
-{
-    if (!head)
-    {
-        printf("FD INFO: EMPTY LIST\n");
-        return;
-    }
-    
-    printf("===== FILE DESCRIPTOR INFO =====\n");
-    t_cmd *current = head;
-    int index = 0;
-    
-    while (current)
-    {
-        printf("CMD[%d]: fd=%d", index, current->hd);
-        
-        if (current->hd == -1)
-            printf(" (INVALID/CLOSED)");
-        else if (current->hd == 0)
-            printf(" (STDIN)");
-        else if (current->hd == 1)
-            printf(" (STDOUT)");
-        else if (current->hd == 2)
-            printf(" (STDERR)");
-        else if (current->hd > 2)
-            printf(" (CUSTOM FD - likely heredoc)");
-        
-        printf("\n");
-        current = current->next;
-        index++;
-    }
-    printf("===============================\n");
-}
\ No newline at end of file
@@ -20,10 +20,21 @@ static char	*token_type_str(t_token_type type)
 	if (type == T_REDIR_OUT) return "REDIR_OUT";
 	if (type == T_APPEND) return "APPEND";
 	if (type == T_HEREDOC) return "HEREDOC";
+	if (type == T_HERESTRING) return "HERESTRING";
+	if (type == T_DUP_IN) return "DUP_IN";
+	if (type == T_DUP_OUT) return "DUP_OUT";
+	if (type == T_SEMI) return "SEMI";
+	if (type == T_AND) return "AND";
+	if (type == T_OR) return "OR";
+	if (type == T_DSEMI) return "DSEMI";
+	if (type == T_LPAREN) return "LPAREN";
+	if (type == T_RPAREN) return "RPAREN";
+	if (type == T_NEWLINE) return "NEWLINE";
 	if (type == T_END) return "END";
 	if (type == T_ERROR) return "ERROR";
 	if (type == T_CORRECT_FILNAME) return "CORRECT_FILENAME";
 	if (type == T_WRONG_FILNAME) return "WRONG_FILENAME";
+	if (type == T_BRACE) return "BRACE";
 	return "UNKNOWN";
 }
 
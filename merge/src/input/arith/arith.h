@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:12:40 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 10:12:40 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARITH_H
+# define ARITH_H
+# include "types.h"
+# include "libft.h"
+# include "utils.h"
+
+# define ARITH_CACHE_MAX 64
+# define ARITH_MAX_DEPTH 32
+
+# define ARITH_ERR_NOMEM -1
+# define ARITH_ERR_SYNTAX 1
+# define ARITH_ERR_DIV 2
+# define ARITH_ERR_POW 3
+# define ARITH_ERR_DEPTH 4
+
+typedef enum e_arith_op
+{
+	AR_NUM,
+	AR_VAR,
+	AR_NEG,
+	AR_POS,
+	AR_NOT,
+	AR_BNOT,
+	AR_COMMA,
+	AR_COND,
+	AR_OR,
+	AR_AND,
+	AR_BOR,
+	AR_XOR,
+	AR_BAND,
+	AR_EQ,
+	AR_NE,
+	AR_LT,
+	AR_LE,
+	AR_GT,
+	AR_GE,
+	AR_SHL,
+	AR_SHR,
+	AR_ADD,
+	AR_SUB,
+	AR_MUL,
+	AR_DIV,
+	AR_MOD,
+	AR_POW
+}	t_arith_op;
+
+//식 트리 노드, 단항은 kid[0], 이항은 kid[0..1], 삼항은 kid[0..2]
+typedef struct s_arith
+{
+	t_arith_op		op;
+	long long		num;
+	char			*name;
+	struct s_arith	*kid[3];
+}	t_arith;
+
+typedef struct s_arith_parser
+{
+	const char	*s;
+	size_t		pos;
+	int			err;
+}	t_arith_parser;
+
+//식 문자열 -> 파싱된 트리
+typedef struct s_arith_cache
+{
+	t_lru	lru;
+	t_arith	*tree;
+}	t_arith_cache;
+
+typedef struct s_arith_ctx
+{
+	t_envp	*envp_lst;
+	int		depth;
+	int		err;
+}	t_arith_ctx;
+
+//arith_lex.c
+void	arith_skip_space(t_arith_parser *p);
+int		arith_number(t_arith_parser *p, long long *out);
+int		arith_infix(const char *s, t_arith_op *op, size_t *len);
+int		arith_prefix(char c, t_arith_op *op);
+
+//arith_node.c, arith_parse.c
+t_arith	*arith_new_node(t_arith_parser *p, t_arith_op op, t_arith *a,
+			t_arith *b);
+t_arith	*arith_operand(t_arith_parser *p);
+void	arith_free(t_arith *node);
+t_arith	*arith_parse_expr(t_arith_parser *p, int min_bp);
+t_arith	*arith_parse(const char *src, int *err);
+
+//arith_eval.c, arith_ops.c
+int		arith_eval(t_arith *node, t_arith_ctx *ctx, long long *out);
+int		arith_binary(t_arith_op op, long long a, long long b,
+			long long *out);
+
+//arith_cache.c
+int		arith_eval_text(const char *src, t_arith_ctx *ctx, long long *out);
+void	arith_trim_cache(int keep);
+
+#endif
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_cache.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 11:43:18 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 11:43:18 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <limits.h>
+#include "arith.h"
+#include "list.h"
+
+static void	delone_arith_cache(t_lru *node)
+{
+	free(node->key);
+	arith_free(((t_arith_cache *)node)->tree);
+	free(node);
+}
+
+//식 캐시는 t_shell에 있음 (확장 함수들이 t_shell을 받지 않으므로 current_shell로)
+//캐시에 없으면 파싱해서 맨 앞에 넣음 (문법 오류난 식은 넣지 않음)
+//개수 제한은 식 하나를 다 계산한 뒤 arith_trim_cache로
+static t_arith	*get_tree(const char *src, int *err)
+{
+	t_lru			**head;
+	t_arith_cache	*entry;
+	t_arith			*tree;
+	char			*key;
+
+	head = &current_shell(NULL)->arith_cache;
+	entry = (t_arith_cache *)lru_find(head, src, ft_strlen(src));
+	if (entry)
+		return (entry->tree);
+	tree = arith_parse(src, err);
+	if (!tree)
+		return (NULL);
+	entry = malloc(sizeof(t_arith_cache));
+	key = ft_strdup(src);
+	if (!entry || !key)
+		return (free(entry), free(key), arith_free(tree),
+			*err = ARITH_ERR_NOMEM, NULL);
+	lru_key(&entry->lru, key, ft_strlen(key));
+	entry->tree = tree;
+	lru_push(head, &entry->lru, INT_MAX, delone_arith_cache);
+	return (tree);
+}
+
+//식 문자열을 계산, 같은 식은 한번만 파싱됨
+//변수 값이 또 식이면 재귀로 들어오므로 깊이를 제한
+int	arith_eval_text(const char *src, t_arith_ctx *ctx, long long *out)
+{
+	t_arith	*tree;
+	int		ret;
+
+	if (ctx->depth >= ARITH_MAX_DEPTH)
+		return (ctx->err = ARITH_ERR_DEPTH, 0);
+	tree = get_tree(src, &ctx->err);
+	if (!tree)
+		return (0);
+	ctx->depth++;
+	ret = arith_eval(tree, ctx, out);
+	ctx->depth--;
+	return (ret);
+}
+
+//앞에서 keep개만 남김, 계산 중인 트리가 지워지지 않게 식 하나를 다 계산한 뒤 호출
+//keep이 0이면 전부 해제
+void	arith_trim_cache(int keep)
+{
+	lru_trim(&current_shell(NULL)->arith_cache, keep, delone_arith_cache);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_eval.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 11:26:45 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 11:26:45 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arith.h"
+#include "expand.h"
+#include "global.h"
+
+//공백과 부호를 빼면 10진수 숫자만 있는 값인지 (대부분의 변수가 여기서 끝남)
+static int	plain_number(const char *s, long long *out)
+{
+	unsigned long long	n;
+	int					neg;
+
+	while (is_space(*s))
+		s++;
+	neg = (*s == '-');
+	if (*s == '-' || *s == '+')
+		s++;
+	if (!ft_isdigit(*s) || (*s == '0' && ft_isdigit(s[1])))
+		return (0);
+	n = 0;
+	while (ft_isdigit(*s))
+		n = n * 10 + (*s++ - '0');
+	while (is_space(*s))
+		s++;
+	if (*s)
+		return (0);
+	if (neg)
+		n = 0ULL - n;
+	*out = (long long)n;
+	return (1);
+}
+
+//unset이나 빈 값은 0, 숫자가 아니면 그 값을 다시 식으로 계산 (bash와 같음)
+static int	eval_var(const char *name, t_arith_ctx *ctx, long long *out)
+{
+	const char	*val;
+
+	if (name[0] == '?')
+		return (*out = g_exit_status, 1);
+	val = lookup_env(name, ft_strlen(name), ctx->envp_lst);
+	*out = 0;
+	if (!val || plain_number(val, out))
+		return (1);
+	return (arith_eval_text(val, ctx, out));
+}
+
+//&&, ||, ?: 는 필요한 쪽만 계산
+static int	eval_lazy(t_arith *node, t_arith_ctx *ctx, long long *out)
+{
+	long long	a;
+
+	if (!arith_eval(node->kid[0], ctx, &a))
+		return (0);
+	if (node->op == AR_COND)
+		return (arith_eval(node->kid[1 + (a == 0)], ctx, out));
+	if ((node->op == AR_AND && !a) || (node->op == AR_OR && a))
+		return (*out = (a != 0), 1);
+	if (!arith_eval(node->kid[1], ctx, &a))
+		return (0);
+	return (*out = (a != 0), 1);
+}
+
+static void	eval_unary(t_arith_op op, long long a, long long *out)
+{
+	if (op == AR_NEG)
+		*out = (long long)(0ULL - (unsigned long long)a);
+	else if (op == AR_NOT)
+		*out = !a;
+	else if (op == AR_BNOT)
+		*out = ~a;
+	else
+		*out = a;
+}
+
+//트리를 계산, 오류면 ctx->err를 세팅하고 0
+int	arith_eval(t_arith *node, t_arith_ctx *ctx, long long *out)
+{
+	long long	a;
+	long long	b;
+
+	if (node->op == AR_NUM)
+		return (*out = node->num, 1);
+	if (node->op == AR_VAR)
+		return (eval_var(node->name, ctx, out));
+	if (node->op == AR_AND || node->op == AR_OR || node->op == AR_COND)
+		return (eval_lazy(node, ctx, out));
+	if (!arith_eval(node->kid[0], ctx, &a))
+		return (0);
+	if (node->op <= AR_BNOT)
+		return (eval_unary(node->op, a, out), 1);
+	if (!arith_eval(node->kid[1], ctx, &b))
+		return (0);
+	ctx->err = arith_binary(node->op, a, b, out);
+	return (ctx->err == 0);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_lex.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:20:11 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 10:20:11 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arith.h"
+
+void	arith_skip_space(t_arith_parser *p)
+{
+	while (is_space(p->s[p->pos]))
+		p->pos++;
+}
+
+static int	digit_value(char c)
+{
+	if (ft_isdigit(c))
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 10);
+	return (64);
+}
+
+//10진수, 0x로 시작하면 16진수, 0으로 시작하면 8진수
+//진법에 안맞는 글자가 붙어 있으면 문법 오류
+int	arith_number(t_arith_parser *p, long long *out)
+{
+	unsigned long long	n;
+	int					base;
+	int					d;
+
+	base = 10;
+	if (p->s[p->pos] == '0' && (p->s[p->pos + 1] == 'x'
+			|| p->s[p->pos + 1] == 'X'))
+	{
+		base = 16;
+		p->pos += 2;
+	}
+	else if (p->s[p->pos] == '0')
+		base = 8;
+	n = 0;
+	while (ft_isalnum(p->s[p->pos]) || p->s[p->pos] == '_')
+	{
+		d = digit_value(p->s[p->pos++]);
+		if (d >= base)
+			return (p->err = ARITH_ERR_SYNTAX, 0);
+		n = n * base + d;
+	}
+	*out = (long long)n;
+	return (1);
+}
+
+//이항 연산자면 binding power (클수록 먼저 묶임), 아니면 0
+//두 글자 연산자를 먼저 비교해야 '<'와 '<<'가 구분됨
+int	arith_infix(const char *s, t_arith_op *op, size_t *len)
+{
+	static const char		*sym[] = {"||", "&&", "==", "!=", "<=", ">=",
+		"<<", ">>", "**", "|", "^", "&", "<", ">", "+", "-", "*", "/", "%",
+		"?", ",", NULL};
+	static const t_arith_op	ops[] = {AR_OR, AR_AND, AR_EQ, AR_NE, AR_LE,
+		AR_GE, AR_SHL, AR_SHR, AR_POW, AR_BOR, AR_XOR, AR_BAND, AR_LT, AR_GT,
+		AR_ADD, AR_SUB, AR_MUL, AR_DIV, AR_MOD, AR_COND, AR_COMMA};
+	static const int		bp[] = {3, 4, 8, 8, 9, 9, 10, 10, 13, 5, 6, 7,
+		9, 9, 11, 11, 12, 12, 12, 2, 1};
+	int						i;
+
+	i = 0;
+	while (sym[i])
+	{
+		*len = ft_strlen(sym[i]);
+		if (ft_strncmp(s, sym[i], *len) == 0)
+			return (*op = ops[i], bp[i]);
+		i++;
+	}
+	return (0);
+}
+
+int	arith_prefix(char c, t_arith_op *op)
+{
+	if (c == '-')
+		*op = AR_NEG;
+	else if (c == '+')
+		*op = AR_POS;
+	else if (c == '!')
+		*op = AR_NOT;
+	else if (c == '~')
+		*op = AR_BNOT;
+	else
+		return (0);
+	return (1);
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_node.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:34:52 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 10:34:52 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arith.h"
+
+//이미 오류가 났으면 받은 자식들까지 해제하고 NULL
+t_arith	*arith_new_node(t_arith_parser *p, t_arith_op op, t_arith *a,
+			t_arith *b)
+{
+	t_arith	*node;
+
+	node = NULL;
+	if (!p->err)
+		node = ft_calloc(1, sizeof(t_arith));
+	if (!node)
+	{
+		if (!p->err)
+			p->err = ARITH_ERR_NOMEM;
+		arith_free(a);
+		arith_free(b);
+		return (NULL);
+	}
+	node->op = op;
+	node->kid[0] = a;
+	node->kid[1] = b;
+	return (node);
+}
+
+void	arith_free(t_arith *node)
+{
+	if (!node)
+		return ;
+	arith_free(node->kid[0]);
+	arith_free(node->kid[1]);
+	arith_free(node->kid[2]);
+	free(node->name);
+	free(node);
+}
+
+//name, $name, ${name}, $?, $1 (위치 인자는 함수 안에서 쓰임)
+static t_arith	*parse_var(t_arith_parser *p)
+{
+	size_t	len;
+	int		brace;
+	t_arith	*node;
+
+	brace = -1;
+	if (p->s[p->pos] == '$')
+		brace = (p->s[++p->pos] == '{');
+	p->pos += (brace == 1);
+	len = 0;
+	while (brace >= 0 && ft_isdigit(p->s[p->pos + len]))
+		len++;
+	if (!len)
+		len = (brace >= 0 && p->s[p->pos] == '?');
+	if (!len && (ft_isalpha(p->s[p->pos]) || p->s[p->pos] == '_'))
+		while (ft_isalnum(p->s[p->pos + len]) || p->s[p->pos + len] == '_')
+			len++;
+	if (len == 0 || (brace == 1 && p->s[p->pos + len] != '}'))
+		return (p->err = ARITH_ERR_SYNTAX, NULL);
+	node = arith_new_node(p, AR_VAR, NULL, NULL);
+	if (!node)
+		return (NULL);
+	node->name = ft_substr(p->s, p->pos, len);
+	if (!node->name)
+		return (p->err = ARITH_ERR_NOMEM, arith_free(node), NULL);
+	p->pos += len + (brace == 1);
+	return (node);
+}
+
+//숫자 또는 변수 하나
+t_arith	*arith_operand(t_arith_parser *p)
+{
+	t_arith		*node;
+	long long	n;
+
+	if (!ft_isdigit(p->s[p->pos]))
+		return (parse_var(p));
+	if (!arith_number(p, &n))
+		return (NULL);
+	node = arith_new_node(p, AR_NUM, NULL, NULL);
+	if (node)
+		node->num = n;
+	return (node);
+}
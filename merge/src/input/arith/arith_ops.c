@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 11:08:03 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 11:08:03 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arith.h"
+
+//음수 지수는 오류, 넘치면 64비트로 wrap
+static int	eval_pow(long long a, long long b, long long *out)
+{
+	unsigned long long	r;
+	unsigned long long	base;
+
+	if (b < 0)
+		return (ARITH_ERR_POW);
+	r = 1;
+	base = (unsigned long long)a;
+	while (b)
+	{
+		if (b & 1)
+			r *= base;
+		base *= base;
+		b >>= 1;
+	}
+	*out = (long long)r;
+	return (0);
+}
+
+//+ - *는 unsigned로 계산해서 넘치면 wrap (bash와 같음)
+//LLONG_MIN / -1 도 wrap 되도록 따로 처리
+static int	eval_math(t_arith_op op, long long a, long long b, long long *out)
+{
+	if (op == AR_ADD)
+		*out = (long long)((unsigned long long)a + (unsigned long long)b);
+	else if (op == AR_SUB)
+		*out = (long long)((unsigned long long)a - (unsigned long long)b);
+	else if (op == AR_MUL)
+		*out = (long long)((unsigned long long)a * (unsigned long long)b);
+	else if (op == AR_POW)
+		return (eval_pow(a, b, out));
+	else if (b == 0)
+		return (ARITH_ERR_DIV);
+	else if (b == -1 && op == AR_DIV)
+		*out = (long long)(0ULL - (unsigned long long)a);
+	else if (b == -1)
+		*out = 0;
+	else if (op == AR_DIV)
+		*out = a / b;
+	else
+		*out = a % b;
+	return (0);
+}
+
+static void	eval_compare(t_arith_op op, long long a, long long b,
+				long long *out)
+{
+	if (op == AR_EQ)
+		*out = (a == b);
+	else if (op == AR_NE)
+		*out = (a != b);
+	else if (op == AR_LT)
+		*out = (a < b);
+	else if (op == AR_LE)
+		*out = (a <= b);
+	else if (op == AR_GT)
+		*out = (a > b);
+	else
+		*out = (a >= b);
+}
+
+//시프트 횟수는 하위 6비트만 사용 (64비트 밖으로 밀면 UB라서)
+static void	eval_bits(t_arith_op op, long long a, long long b, long long *out)
+{
+	if (op == AR_SHL)
+		*out = (long long)((unsigned long long)a << (b & 63));
+	else if (op == AR_SHR)
+		*out = a >> (b & 63);
+	else if (op == AR_BAND)
+		*out = a & b;
+	else if (op == AR_XOR)
+		*out = a ^ b;
+	else if (op == AR_BOR)
+		*out = a | b;
+	else
+		*out = b;
+}
+
+//양쪽 값이 다 계산된 이항 연산, 오류 코드 반환 (0이면 성공)
+int	arith_binary(t_arith_op op, long long a, long long b, long long *out)
+{
+	if (op >= AR_ADD)
+		return (eval_math(op, a, b, out));
+	if (op >= AR_EQ && op <= AR_GE)
+		eval_compare(op, a, b, out);
+	else
+		eval_bits(op, a, b, out);
+	return (0);
+}
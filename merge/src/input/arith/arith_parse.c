@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:51:27 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 10:51:27 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arith.h"
+
+//괄호, 단항 연산자, 숫자/변수
+//단항은 '**'보다 세게 묶임 (-2**2 == 4, bash와 같음)
+static t_arith	*parse_prefix(t_arith_parser *p)
+{
+	t_arith		*node;
+	t_arith_op	op;
+
+	arith_skip_space(p);
+	if (p->s[p->pos] == '(')
+	{
+		p->pos++;
+		node = arith_parse_expr(p, 0);
+		arith_skip_space(p);
+		if (node && p->s[p->pos] != ')')
+			return (p->err = ARITH_ERR_SYNTAX, arith_free(node), NULL);
+		p->pos++;
+		return (node);
+	}
+	if (arith_prefix(p->s[p->pos], &op))
+	{
+		p->pos++;
+		node = arith_parse_expr(p, 13);
+		return (arith_new_node(p, op, node, NULL));
+	}
+	return (arith_operand(p));
+}
+
+//cond ? a : b, 가운데는 식 전체를 받고 뒤쪽은 오른쪽 결합
+static t_arith	*parse_cond(t_arith_parser *p, t_arith *cond, int bp)
+{
+	t_arith	*node;
+
+	node = arith_new_node(p, AR_COND, cond, arith_parse_expr(p, 0));
+	if (!node)
+		return (NULL);
+	arith_skip_space(p);
+	if (p->s[p->pos] != ':')
+		p->err = ARITH_ERR_SYNTAX;
+	else
+	{
+		p->pos++;
+		node->kid[2] = arith_parse_expr(p, bp - 1);
+	}
+	if (p->err)
+		return (arith_free(node), NULL);
+	return (node);
+}
+
+//Pratt 파서: min_bp보다 센 연산자만 왼쪽 피연산자에 이어붙임
+//'**'와 '?:'만 오른쪽 결합
+t_arith	*arith_parse_expr(t_arith_parser *p, int min_bp)
+{
+	t_arith		*lhs;
+	t_arith_op	op;
+	size_t		len;
+	int			bp;
+
+	lhs = parse_prefix(p);
+	while (!p->err)
+	{
+		arith_skip_space(p);
+		bp = arith_infix(p->s + p->pos, &op, &len);
+		if (bp <= min_bp)
+			break ;
+		p->pos += len;
+		if (op == AR_COND)
+			lhs = parse_cond(p, lhs, bp);
+		else if (op == AR_POW)
+			lhs = arith_new_node(p, op, lhs, arith_parse_expr(p, bp - 1));
+		else
+			lhs = arith_new_node(p, op, lhs, arith_parse_expr(p, bp));
+	}
+	return (lhs);
+}
+
+//식 전체를 트리로, 빈 식은 0
+//실패하면 NULL, *err에 이유
+t_arith	*arith_parse(const char *src, int *err)
+{
+	t_arith_parser	p;
+	t_arith			*tree;
+
+	p.s = src;
+	p.pos = 0;
+	p.err = 0;
+	arith_skip_space(&p);
+	if (!src[p.pos])
+		tree = arith_new_node(&p, AR_NUM, NULL, NULL);
+	else
+		tree = arith_parse_expr(&p, 0);
+	arith_skip_space(&p);
+	if (!p.err && src[p.pos])
+	{
+		p.err = ARITH_ERR_SYNTAX;
+		arith_free(tree);
+		tree = NULL;
+	}
+	*err = p.err;
+	return (tree);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:02:11 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:02:11 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BRACE_H
+# define BRACE_H
+# include "types.h"
+# include "libft.h"
+# include "utils.h"
+# include <stdint.h>
+# define BRACE_RESERVE_MAX 65536
+
+typedef enum e_bkind
+{
+	B_TEXT,
+	B_SEQ,
+	B_ALT,
+	B_RANGE
+}	t_bkind;
+
+//TEXT: 글자 그대로, SEQ: 자식들을 이어붙임
+//ALT: {a,b,c} 중 cur번째, RANGE: {from..to..step} 의 cur번째
+typedef struct s_bnode
+{
+	t_bkind			kind;
+	const char		*s;
+	size_t			len;
+	struct s_bnode	**kids;
+	size_t			n;
+	size_t			cur;
+	long			from;
+	long			step;
+	size_t			count;
+	int				width;
+	int				is_char;
+}	t_bnode;
+
+//단어를 하나씩 만들어 out에 덮어씀, 메모리는 가장 긴 단어 하나 크기
+typedef struct s_brace_iter
+{
+	t_bnode	*root;
+	t_sbuf	out;
+	int		done;
+	int		err;
+}	t_brace_iter;
+
+//brace_node.c
+t_bnode		*bnode_new(t_bkind kind, const char *s, size_t len);
+int			bnode_add(t_bnode *parent, t_bnode *kid);
+void		bnode_free(t_bnode *node);
+size_t		bnode_count(t_bnode *node);
+
+//brace_scan.c, brace_parse.c, brace_range.c
+size_t		brace_skip(const char *s, size_t i, size_t len);
+size_t		brace_find_close(const char *s, size_t len, int *comma);
+t_bnode		*brace_parse(const char *s, size_t len);
+int			brace_range(t_bnode *node, const char *s, size_t len);
+int			range_emit(t_bnode *node, t_sbuf *out);
+
+//brace_iter.c
+int			brace_iter_init(t_brace_iter *it, const char *word);
+const char	*brace_iter_next(t_brace_iter *it);
+void		brace_iter_free(t_brace_iter *it);
+
+//brace_expand.c
+int			brace_expand(t_token **token_lst);
+int			brace_word_count(const char *word);
+
+#endif
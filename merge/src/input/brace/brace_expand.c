@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:31:58 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:31:58 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "brace.h"
+#include "list.h"
+
+//만들어질 단어가 더 확장될 일이 없는지 (따옴표, $, glob, ~ 없음)
+//이런 단어는 토큰으로 펼치지 않고 argv를 만들 때 바로 하나씩 넣음
+static int	is_plain(const char *s)
+{
+	while (*s)
+	{
+		if (ft_strchr("'\"\\$*?[~", *s))
+			return (0);
+		s++;
+	}
+	return (1);
+}
+
+//더 확장해야 하는 단어들은 원래 자리에 WORD 토큰으로 끼워넣음
+static t_token	**spread_token(t_token **link, t_brace_iter *it)
+{
+	t_token		*tok;
+	t_token		*new_token;
+	const char	*word;
+	char		*value;
+
+	tok = *link;
+	word = brace_iter_next(it);
+	while (word)
+	{
+		value = ft_strdup(word);
+		new_token = NULL;
+		if (value)
+			new_token = create_token(value, T_WORD);
+		if (!new_token)
+			return (free(value), NULL);
+		new_token->next = tok;
+		*link = new_token;
+		link = &new_token->next;
+		word = brace_iter_next(it);
+	}
+	if (it->err)
+		return (NULL);
+	*link = tok->next;
+	tok->next = NULL;
+	clear_token_list(&tok);
+	return (link);
+}
+
+//다음에 볼 토큰을 가리키는 link 반환, 실패시 NULL
+static t_token	**brace_token(t_token **link)
+{
+	t_brace_iter	it;
+	int				r;
+
+	r = brace_iter_init(&it, (*link)->value);
+	if (r < 0)
+		return (NULL);
+	if (r == 0)
+		return (&(*link)->next);
+	if (is_plain((*link)->value))
+	{
+		brace_iter_free(&it);
+		(*link)->type = T_BRACE;
+		return (&(*link)->next);
+	}
+	link = spread_token(link, &it);
+	brace_iter_free(&it);
+	return (link);
+}
+
+//다른 확장보다 먼저, 따옴표가 남아있는 단어에서 {a,b}, {1..N} 처리
+//리다이렉션 대상, herdoc 구분자, here-string은 건드리지 않음
+int	brace_expand(t_token **token_lst)
+{
+	t_token	**link;
+
+	link = token_lst;
+	while (link && *link && (*link)->type != T_END)
+	{
+		if (is_redir_type((*link)->type) && (*link)->next)
+			link = &(*link)->next->next;
+		else if ((*link)->type == T_WORD && (*link)->value)
+			link = brace_token(link);
+		else
+			link = &(*link)->next;
+	}
+	return (link != NULL);
+}
+
+//BRACE 토큰이 만들 단어 수 (argv 미리 잡기용이라 적당히 자름)
+int	brace_word_count(const char *word)
+{
+	t_brace_iter	it;
+	size_t			count;
+
+	if (brace_iter_init(&it, word) <= 0)
+		return (1);
+	count = bnode_count(it.root);
+	brace_iter_free(&it);
+	if (count > BRACE_RESERVE_MAX)
+		return (BRACE_RESERVE_MAX);
+	return ((int)count);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_iter.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:24:16 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:24:16 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "brace.h"
+
+//오른쪽부터 자리올림하는 카운터처럼 다음 조합으로
+//한바퀴 돌아 처음 상태로 돌아오면 0
+static int	advance(t_bnode *node)
+{
+	size_t	i;
+
+	if (node->kind == B_TEXT)
+		return (0);
+	if (node->kind == B_RANGE)
+	{
+		if (++node->cur < node->count)
+			return (1);
+		node->cur = 0;
+		return (0);
+	}
+	if (node->kind == B_ALT)
+	{
+		if (advance(node->kids[node->cur]) || ++node->cur < node->n)
+			return (1);
+		node->cur = 0;
+		return (0);
+	}
+	i = node->n;
+	while (i-- > 0)
+		if (advance(node->kids[i]))
+			return (1);
+	return (0);
+}
+
+static int	emit(t_bnode *node, t_sbuf *out)
+{
+	size_t	i;
+
+	if (node->kind == B_TEXT)
+		return (sbuf_append(out, node->s, node->len));
+	if (node->kind == B_RANGE)
+		return (range_emit(node, out));
+	if (node->kind == B_ALT)
+		return (emit(node->kids[node->cur], out));
+	i = 0;
+	while (i < node->n)
+		if (!emit(node->kids[i++], out))
+			return (0);
+	return (1);
+}
+
+//brace 식이 있으면 1, 없으면 0, 메모리 오류면 -1
+//word는 반복이 끝날 때까지 그대로 있어야 함
+int	brace_iter_init(t_brace_iter *it, const char *word)
+{
+	size_t	i;
+
+	ft_memset(it, 0, sizeof(t_brace_iter));
+	if (!ft_strchr(word, '{'))
+		return (0);
+	it->root = brace_parse(word, ft_strlen(word));
+	if (!it->root)
+		return (-1);
+	i = 0;
+	while (i < it->root->n && it->root->kids[i]->kind == B_TEXT)
+		i++;
+	if (i == it->root->n)
+		return (brace_iter_free(it), 0);
+	if (!sbuf_init(&it->out, 0))
+		return (brace_iter_free(it), -1);
+	return (1);
+}
+
+//다음 단어 (다음 호출 전까지만 유효), 끝이나 오류면 NULL
+//bash처럼 빈 단어는 건너뜀
+const char	*brace_iter_next(t_brace_iter *it)
+{
+	while (!it->done && !it->err)
+	{
+		it->out.len = 0;
+		it->out.data[0] = '\0';
+		it->err = !emit(it->root, &it->out);
+		it->done = !advance(it->root);
+		if (!it->err && it->out.len)
+			return (it->out.data);
+	}
+	return (NULL);
+}
+
+void	brace_iter_free(t_brace_iter *it)
+{
+	bnode_free(it->root);
+	it->root = NULL;
+	sbuf_free(&it->out);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_node.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:04:37 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:04:37 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "brace.h"
+
+t_bnode	*bnode_new(t_bkind kind, const char *s, size_t len)
+{
+	t_bnode	*node;
+
+	node = malloc(sizeof(t_bnode));
+	if (!node)
+		return (NULL);
+	ft_memset(node, 0, sizeof(t_bnode));
+	node->kind = kind;
+	node->s = s;
+	node->len = len;
+	return (node);
+}
+
+//자식 배열은 개수가 2의 거듭제곱이 될 때마다 두배로 늘림
+//실패하면 kid까지 해제
+int	bnode_add(t_bnode *parent, t_bnode *kid)
+{
+	t_bnode	**new_kids;
+
+	if (!kid)
+		return (0);
+	if ((parent->n & (parent->n - 1)) == 0)
+	{
+		new_kids = malloc(sizeof(t_bnode *) * (parent->n * 2 + 1));
+		if (!new_kids)
+			return (bnode_free(kid), 0);
+		if (parent->n)
+			ft_memcpy(new_kids, parent->kids, sizeof(t_bnode *) * parent->n);
+		free(parent->kids);
+		parent->kids = new_kids;
+	}
+	parent->kids[parent->n++] = kid;
+	return (1);
+}
+
+void	bnode_free(t_bnode *node)
+{
+	size_t	i;
+
+	if (!node)
+		return ;
+	i = 0;
+	while (i < node->n)
+		bnode_free(node->kids[i++]);
+	free(node->kids);
+	free(node);
+}
+
+//만들어질 단어 수 (넘치면 SIZE_MAX에서 멈춤)
+size_t	bnode_count(t_bnode *node)
+{
+	size_t	total;
+	size_t	c;
+	size_t	i;
+
+	if (node->kind == B_TEXT)
+		return (1);
+	if (node->kind == B_RANGE)
+		return (node->count);
+	total = (node->kind == B_SEQ);
+	i = 0;
+	while (i < node->n)
+	{
+		c = bnode_count(node->kids[i++]);
+		if (node->kind == B_ALT && total > SIZE_MAX - c)
+			return (SIZE_MAX);
+		if (node->kind == B_SEQ && c && total > SIZE_MAX / c)
+			return (SIZE_MAX);
+		if (node->kind == B_ALT)
+			total += c;
+		else
+			total *= c;
+	}
+	return (total);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:13:05 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:13:05 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "brace.h"
+
+static int	push_text(t_bnode *seq, const char *s, size_t n)
+{
+	if (n == 0)
+		return (1);
+	return (bnode_add(seq, bnode_new(B_TEXT, s, n)));
+}
+
+//{a,b,c} 의 안쪽을 바깥 단계의 ','로 나누고 각각을 다시 파싱
+static t_bnode	*parse_alt(const char *s, size_t len)
+{
+	t_bnode	*alt;
+	size_t	start;
+	size_t	i;
+	int		depth;
+
+	alt = bnode_new(B_ALT, NULL, 0);
+	start = 0;
+	i = 0;
+	depth = 0;
+	while (alt && i <= len)
+	{
+		if (i == len || (s[i] == ',' && depth == 0))
+		{
+			if (!bnode_add(alt, brace_parse(s + start, i - start)))
+				return (bnode_free(alt), NULL);
+			start = ++i;
+			continue ;
+		}
+		depth += (s[i] == '{') - (s[i] == '}');
+		if (s[i] == '{' || s[i] == '}' || s[i] == ',')
+			i++;
+		else
+			i = brace_skip(s, i, len);
+	}
+	return (alt);
+}
+
+//s가 '{'로 시작하는 brace 식이면 쓴 길이를 돌려주고 노드를 out에
+//','도 없고 범위도 아니면 0 (그냥 글자), 메모리 오류면 out이 NULL
+static size_t	brace_group(const char *s, size_t len, t_bnode **out)
+{
+	size_t	close;
+	int		comma;
+
+	*out = NULL;
+	close = brace_find_close(s, len, &comma);
+	if (close == 0)
+		return (0);
+	if (comma)
+	{
+		*out = parse_alt(s + 1, close - 1);
+		return (close + 1);
+	}
+	*out = bnode_new(B_RANGE, NULL, 0);
+	if (*out && !brace_range(*out, s + 1, close - 1))
+	{
+		bnode_free(*out);
+		*out = NULL;
+		return (0);
+	}
+	return (close + 1);
+}
+
+//단어 하나를 글자 조각과 brace 식의 연결(SEQ)로 파싱
+//TEXT 노드는 s를 가리키므로 s는 노드보다 오래 살아 있어야 함
+t_bnode	*brace_parse(const char *s, size_t len)
+{
+	t_bnode	*seq;
+	t_bnode	*group;
+	size_t	start;
+	size_t	used;
+	size_t	i;
+
+	seq = bnode_new(B_SEQ, NULL, 0);
+	start = 0;
+	i = 0;
+	while (seq && i < len)
+	{
+		used = 0;
+		if (s[i] == '{')
+			used = brace_group(s + i, len - i, &group);
+		if (used == 0)
+			i = brace_skip(s, i, len);
+		else if (!push_text(seq, s + start, i - start))
+			return (bnode_free(group), bnode_free(seq), NULL);
+		else if (!bnode_add(seq, group))
+			return (bnode_free(seq), NULL);
+		if (used)
+			start = i + used;
+		i += used;
+	}
+	if (seq && !push_text(seq, s + start, i - start))
+		return (bnode_free(seq), NULL);
+	return (seq);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_range.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:18:40 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:18:40 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "brace.h"
+
+//범위 끝 하나: 숫자면 1, 글자 하나면 2, 아니면 0
+//width는 앞에 0이 붙은 숫자면 +길이, 아니면 -길이 (자리맞춤 판단용)
+static int	parse_bound(const char *s, size_t n, long *v, int *width)
+{
+	size_t	i;
+
+	if (n == 1 && ft_isalpha(s[0]))
+	{
+		*v = s[0];
+		return (2);
+	}
+	i = (n && (s[0] == '-' || s[0] == '+'));
+	if (i == n || n - i > 18)
+		return (0);
+	*width = -(int)n;
+	if (s[i] == '0' && n - i > 1)
+		*width = n;
+	*v = 0;
+	while (i < n)
+	{
+		if (!ft_isdigit(s[i]))
+			return (0);
+		*v = *v * 10 + (s[i++] - '0');
+	}
+	if (s[0] == '-')
+		*v = -*v;
+	return (1);
+}
+
+static size_t	find_dots(const char *s, size_t len, size_t from)
+{
+	size_t	i;
+
+	i = from + 1;
+	while (i + 1 < len)
+	{
+		if (s[i] == '.' && s[i + 1] == '.')
+			return (i);
+		i++;
+	}
+	return (0);
+}
+
+static void	set_range(t_bnode *node, long v[3], int w[2], int kind)
+{
+	unsigned long	diff;
+
+	if (v[2] < 0)
+		v[2] = -v[2];
+	if (v[2] == 0)
+		v[2] = 1;
+	node->is_char = (kind == 2);
+	node->from = v[0];
+	node->step = v[2];
+	if (v[1] < v[0])
+		node->step = -v[2];
+	diff = (unsigned long)(v[1] - v[0]);
+	if (v[1] < v[0])
+		diff = (unsigned long)(v[0] - v[1]);
+	node->count = diff / (unsigned long)v[2] + 1;
+	node->width = 0;
+	if (kind != 1 || (w[0] < 0 && w[1] < 0))
+		return ;
+	node->width = w[0];
+	if (w[0] < 0)
+		node->width = -w[0];
+	if (w[1] > node->width || -w[1] > node->width)
+		node->width = w[1] * (1 - 2 * (w[1] < 0));
+}
+
+//{x..y} 또는 {x..y..step}, 양 끝은 둘 다 정수이거나 둘 다 알파벳 한 글자
+int	brace_range(t_bnode *node, const char *s, size_t len)
+{
+	size_t	d[2];
+	long	v[3];
+	int		w[3];
+	int		kind;
+
+	d[0] = find_dots(s, len, 0);
+	if (d[0] == 0)
+		return (0);
+	d[1] = find_dots(s, len, d[0] + 2);
+	if (d[1] == 0)
+		d[1] = len;
+	kind = parse_bound(s, d[0], &v[0], &w[0]);
+	if (!kind || kind != parse_bound(s + d[0] + 2, d[1] - d[0] - 2, &v[1], &w[1]))
+		return (0);
+	v[2] = 1;
+	if (d[1] < len && parse_bound(s + d[1] + 2, len - d[1] - 2, &v[2], &w[2]) != 1)
+		return (0);
+	node->kind = B_RANGE;
+	set_range(node, v, w, kind);
+	return (1);
+}
+
+//cur번째 값을 out에 (자리맞춤 width는 부호까지 포함한 길이)
+int	range_emit(t_bnode *node, t_sbuf *out)
+{
+	char	buf[24];
+	long	v;
+	size_t	i;
+	int		len;
+
+	v = node->from + (long)node->cur * node->step;
+	if (node->is_char)
+		return (sbuf_addc(out, (char)v));
+	len = (v < 0);
+	if (v < 0 && !sbuf_addc(out, '-'))
+		return (0);
+	i = sizeof(buf);
+	while (i == sizeof(buf) || v)
+	{
+		buf[--i] = '0' + (v % 10) * (1 - 2 * (v < 0));
+		v /= 10;
+	}
+	len += sizeof(buf) - i;
+	while (len++ < node->width)
+		if (!sbuf_addc(out, '0'))
+			return (0);
+	return (sbuf_append(out, buf + i, sizeof(buf) - i));
+}
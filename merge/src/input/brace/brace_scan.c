@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:09:52 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 15:09:52 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "brace.h"
+
+//따옴표 하나를 건너뜀 ("" 안에서는 \로 닫는 따옴표를 피할 수 있음)
+static size_t	skip_quote(const char *s, size_t i, size_t len)
+{
+	char	q;
+
+	q = s[i++];
+	while (i < len && s[i] != q)
+	{
+		if (q == '"' && s[i] == '\\')
+			i++;
+		i++;
+	}
+	return (i + 1);
+}
+
+//${ } 나 $( ) 는 통째로 건너뜀, 안의 ','나 '{'는 brace가 아님
+static size_t	skip_group(const char *s, size_t i, size_t len)
+{
+	char	open;
+	char	close;
+	int		depth;
+
+	open = s[i + 1];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = 0;
+	i++;
+	while (i < len)
+	{
+		if (s[i] == '\'' || s[i] == '"')
+			i = skip_quote(s, i, len) - 1;
+		else if (s[i] == open)
+			depth++;
+		else if (s[i] == close && --depth == 0)
+			return (i + 1);
+		i++;
+	}
+	return (len);
+}
+
+//brace 문법에 쓰이지 않는 덩어리 하나를 건너뛴 다음 위치
+size_t	brace_skip(const char *s, size_t i, size_t len)
+{
+	if (s[i] == '\\')
+		i += 2;
+	else if (s[i] == '\'' || s[i] == '"')
+		i = skip_quote(s, i, len);
+	else if (s[i] == '$' && i + 1 < len && (s[i + 1] == '{' || s[i + 1] == '('))
+		i = skip_group(s, i, len);
+	else
+		i++;
+	if (i > len)
+		return (len);
+	return (i);
+}
+
+//s[0]의 '{'와 짝이 되는 '}' 위치 (없으면 0)
+//바깥 단계에 ','가 있었는지 comma에 기록
+size_t	brace_find_close(const char *s, size_t len, int *comma)
+{
+	size_t	i;
+	int		depth;
+
+	i = 1;
+	depth = 1;
+	*comma = 0;
+	while (i < len)
+	{
+		if (s[i] == '{')
+			depth++;
+		else if (s[i] == '}' && --depth == 0)
+			return (i);
+		else if (s[i] == ',' && depth == 1)
+			*comma = 1;
+		if (s[i] == '{' || s[i] == '}' || s[i] == ',')
+			i++;
+		else
+			i = brace_skip(s, i, len);
+	}
+	return (0);
+}
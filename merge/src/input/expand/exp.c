@@ -11,102 +11,110 @@
 /* ************************************************************************** */
 
 #include "libft.h"
-#include "global.h"
 #include "expand.h"
+#include "output.h"
+#include "list.h"
 
-static char	*get_expanded_value(char *p, size_t len, t_envp *envp_lst)
+//unset이면 NULL (빈 값과 구분해야 ${v-x} 같은 확장이 가능)
+//숫자로 시작하면 위치 인자, 배열 이름이면 0번 원소
+const char	*lookup_env(const char *p, size_t len, t_envp *envp_lst)
 {
-	char	*expanded;
+	t_array	*arr;
 
-	expanded = NULL;
+	if (len && ft_isdigit(*p))
+		return (positional_param(p, len));
 	while (envp_lst)
 	{
 		if (ft_strncmp(envp_lst->key, p, len) == 0 \
 			&& envp_lst->key[len] == '\0')
-		{
-			expanded = ft_strdup(envp_lst->value);
-			return (expanded);
-		}
+			return (envp_lst->value);
 		envp_lst = envp_lst->next;
 	}
-	return (ft_strdup(""));
+	arr = find_array(current_shell(NULL), p, len);
+	if (arr && arr->assoc)
+		return (assoc_get(arr, "0"));
+	if (arr)
+		return (array_get(arr, 0));
+	return (NULL);
 }
 
-static char	*expand_env(char *p, t_envp *envp_lst, size_t *idx)
+//확장된 글자는 따옴표 안이면 MASK_QUOTED, 밖이면 MASK_UNQUOTED로 표시
+//(field splitting은 MASK_UNQUOTED 글자에서만 일어남)
+int	exp_append_expanded(t_exp *exp_data, const char *s)
 {
-	size_t	start;
+	char	mark;
 	size_t	len;
-	char	*expanded;
 
-	start = *idx;
-	len = 0;
-	if (p[start] == '?')
-	{
-		*idx += 1;
-		return (ft_itoa(g_exit_status));
-	}
-	while (p[start + len] && \
-			(ft_isalnum(p[start + len]) || p[start + len] == '_'))
-		len++;
-	if (len == 0)
-		return (ft_strdup("$"));
-	expanded = get_expanded_value(p + start, len, envp_lst);
-	*idx += len;
-	return (expanded);
+	mark = MASK_UNQUOTED;
+	if (exp_data->state == STATE_IN_DQUOTE)
+		mark = MASK_QUOTED;
+	len = ft_strlen(s);
+	if (!sbuf_append(&exp_data->out, s, len))
+		return (0);
+	while (len--)
+		if (!sbuf_addc(&exp_data->mask, mark))
+			return (0);
+	return (1);
 }
 
+//소스에 있던 글자는 MASK_LITERAL
 int	exp_normal_process(t_exp *exp_data, char *value)
 {
-	char	*new_result;
-
-	new_result = charjoin_and_free(exp_data->result, value[exp_data->idx]);
-	if (!new_result)
+	if (!sbuf_addc(&exp_data->out, value[exp_data->idx])
+		|| !sbuf_addc(&exp_data->mask, MASK_LITERAL))
 	{
-		perror("malloc fail : charjoin_and_free");
-		exp_data->result = NULL;
+		perror("malloc fail : exp_normal_process");
 		return (0);
 	}
-	exp_data->result = new_result;
 	return (1);
 }
 
 int	exp_env_process(t_exp *exp_data, char *value, t_envp *envp_lst)
 {
-	char	*expanded;
-	char	*temp;
+	size_t		len;
+	const char	*expanded;
+	int			ret;
 
 	exp_data->idx++;
-	expanded = expand_env(value, envp_lst, &exp_data->idx);
+	if (value[exp_data->idx] == '{')
+		return (exp_brace_process(exp_data, value, envp_lst));
+	if (value[exp_data->idx] == '(' && value[exp_data->idx + 1] == '(')
+		return (exp_arith_process(exp_data, value, envp_lst));
+	if (value[exp_data->idx] == '(')
+		return (exp_cmdsub_process(exp_data, value));
+	if (value[exp_data->idx]
+		&& ft_strchr(SPECIAL_PARAMS, value[exp_data->idx]))
+		return (exp_param_process(exp_data, value));
+	len = 0;
+	while (ft_isalnum(value[exp_data->idx + len])
+		|| value[exp_data->idx + len] == '_')
+		len++;
+	if (len == 0)
+		return (sbuf_addc(&exp_data->out, '$')
+			&& sbuf_addc(&exp_data->mask, MASK_LITERAL));
+	expanded = lookup_env(value + exp_data->idx, len, envp_lst);
 	if (!expanded)
-	{
-		perror("malloc fail : expand_env");
-		return (free(exp_data->result), exp_data->result = NULL, 0);
-	}
-	temp = ft_strjoin(exp_data->result, expanded);
-	if (!temp)
-	{
-		perror("malloc fail : ft_strjoin");
-		return (free(exp_data->result), exp_data->result = NULL, \
-				free(expanded), 0);
-	}
-	free(exp_data->result);
-	free(expanded);
-	exp_data->result = temp;
-	return (1);
+		expanded = "";
+	ret = exp_append_expanded(exp_data, expanded);
+	exp_data->idx += len;
+	return (ret);
 }
 
 int	set_exp_data(t_exp *exp_data)
 {
-	char	*res;
-
-	res = ft_strdup("");
-	if (!res)
+	exp_data->state = STATE_GENERAL;
+	exp_data->idx = 0;
+	exp_data->word = 0;
+	if (!sbuf_init(&exp_data->out, 0))
 	{
 		perror("malloc fail : set_exp_data");
 		return (0);
 	}
-	exp_data->state = STATE_GENERAL;
-	exp_data->idx = 0;
-	exp_data->result = res;
+	if (!sbuf_init(&exp_data->mask, 0))
+	{
+		perror("malloc fail : set_exp_data");
+		sbuf_free(&exp_data->out);
+		return (0);
+	}
 	return (1);
 }
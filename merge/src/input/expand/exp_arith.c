@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_arith.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 12:02:36 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 12:02:36 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+#include "arith.h"
+
+//'$((' 다음부터 식이 끝나는 위치 (짝이 맞는 '))' 앞), 없으면 0
+static size_t	find_arith_end(const char *value, size_t start)
+{
+	size_t	i;
+	int		depth;
+
+	depth = 0;
+	i = start;
+	while (value[i])
+	{
+		if (value[i] == '(')
+			depth++;
+		else if (value[i] == ')' && depth == 0)
+			return (i * (value[i + 1] == ')'));
+		else if (value[i] == ')')
+			depth--;
+		i++;
+	}
+	return (0);
+}
+
+static void	arith_error(const char *src, int err)
+{
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd((char *)src, 2);
+	if (err == ARITH_ERR_DIV)
+		ft_putendl_fd(": division by 0", 2);
+	else if (err == ARITH_ERR_POW)
+		ft_putendl_fd(": exponent less than 0", 2);
+	else if (err == ARITH_ERR_DEPTH)
+		ft_putendl_fd(": expression recursion level exceeded", 2);
+	else
+		ft_putendl_fd(": syntax error in expression", 2);
+	exp_error(1);
+}
+
+//64비트 정수를 buf에 10진수로
+static char	*num_to_str(long long n, char buf[24])
+{
+	unsigned long long	u;
+	int					i;
+
+	u = (unsigned long long)n;
+	if (n < 0)
+		u = 0ULL - u;
+	i = 23;
+	buf[i] = '\0';
+	buf[--i] = '0' + u % 10;
+	while (u / 10)
+	{
+		u /= 10;
+		buf[--i] = '0' + u % 10;
+	}
+	if (n < 0)
+		buf[--i] = '-';
+	return (buf + i);
+}
+
+//식 안에 $( )나 ${ }가 있으면 먼저 확장 (그런 식은 매번 글자가 달라질 수 있음)
+static char	*arith_source(char *value, size_t start, size_t end,
+				t_envp *envp_lst)
+{
+	char	*src;
+	char	*expanded;
+
+	src = ft_substr(value, start, end - start);
+	if (!src || (!ft_strnstr(src, "$(", end - start)
+			&& !ft_strnstr(src, "${", end - start)))
+		return (src);
+	expanded = expand_process(src, envp_lst);
+	free(src);
+	return (expanded);
+}
+
+//$(( 식 )) 을 fork 없이 계산, 파싱된 트리는 식 문자열로 캐시됨
+//식이 잘못되면 에러 출력 후 0 (${...}의 bad substitution과 같이 명령을 건너뜀)
+//'))'로 안닫히면 $( (...) ...) 명령 치환으로 봄
+int	exp_arith_process(t_exp *exp_data, char *value, t_envp *envp_lst)
+{
+	size_t		start;
+	char		*src;
+	t_arith_ctx	ctx;
+	long long	n;
+	char		buf[24];
+
+	start = exp_data->idx + 2;
+	exp_data->idx = find_arith_end(value, start);
+	if (!exp_data->idx)
+		return (exp_data->idx = start - 2,
+			exp_cmdsub_process(exp_data, value));
+	src = arith_source(value, start, exp_data->idx, envp_lst);
+	exp_data->idx += 2;
+	if (!src)
+		return (0);
+	ft_memset(&ctx, 0, sizeof(t_arith_ctx));
+	ctx.envp_lst = envp_lst;
+	if (!arith_eval_text(src, &ctx, &n) && ctx.err != ARITH_ERR_NOMEM)
+		arith_error(src, ctx.err);
+	arith_trim_cache(ARITH_CACHE_MAX);
+	free(src);
+	if (ctx.err)
+		return (0);
+	return (exp_append_expanded(exp_data, num_to_str(n, buf)));
+}
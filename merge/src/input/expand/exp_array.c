@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_array.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 18:02:37 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 18:02:37 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+#include "arith.h"
+#include "list.h"
+#include "output.h"
+
+//name 바로 뒤의 [...]를 짝이 맞는 ']'까지 (안쪽 [ ]도 셈), 없으면 0
+size_t	parse_subscript(const char *s, size_t n, t_brace *br)
+{
+	size_t	i;
+	int		depth;
+
+	if (n == 0 || s[0] != '[')
+		return (0);
+	depth = 0;
+	i = 0;
+	while (i < n)
+	{
+		depth += (s[i] == '[') - (s[i] == ']');
+		if (depth == 0)
+			break ;
+		i++;
+	}
+	if (i == n)
+		return (0);
+	br->sub = s + 1;
+	br->sub_len = i - 1;
+	return (i + 1);
+}
+
+//첨자 배열의 첨자는 산술식, 음수는 끝에서부터 (arr가 NULL이면 길이 0)
+//잘못된 식이나 범위 밖의 음수면 에러 출력 후 0
+int	subscript_index(t_array *arr, const char *key, t_envp *envp_lst,
+		size_t *i)
+{
+	t_arith_ctx	ctx;
+	long long	n;
+	int			ok;
+
+	ft_memset(&ctx, 0, sizeof(t_arith_ctx));
+	ctx.envp_lst = envp_lst;
+	ok = (*key && arith_eval_text(key, &ctx, &n));
+	arith_trim_cache(ARITH_CACHE_MAX);
+	if (ok && n < 0 && arr)
+		n += arr->len;
+	if (ok && n >= 0)
+		return (*i = n, 1);
+	ft_putstr_fd("minishell: ", 2);
+	if (arr)
+		ft_putstr_fd(arr->name, 2);
+	else
+		ft_putstr_fd((char *)key, 2);
+	ft_putendl_fd(": bad array subscript", 2);
+	return (0);
+}
+
+//${a[i]} 하나, 첨자는 확장해서 연관 배열이면 그대로 키
+//배열이 아닌 변수는 0번 원소만 있는 것으로 봄
+const char	*array_elem(t_brace *br, t_envp *envp_lst)
+{
+	t_array		*arr;
+	char		*key;
+	const char	*v;
+	size_t		i;
+
+	key = brace_word(br->sub, br->sub_len, envp_lst);
+	if (!key)
+		return (NULL);
+	arr = find_array(current_shell(NULL), br->name, br->name_len);
+	v = NULL;
+	i = 1;
+	if (arr && arr->assoc)
+		v = assoc_get(arr, key);
+	else if (subscript_index(arr, key, envp_lst, &i) && arr)
+		v = array_get(arr, i);
+	else if (!arr && i == 0)
+		v = lookup_env(br->name, br->name_len, envp_lst);
+	free(key);
+	return (v);
+}
+
+//${a[@]} ${a[*]} ${!a[@]}: 원소(또는 첨자)를 argv 단어로 바로 붙임
+//'@'는 따옴표 안에서도 원소마다 단어, '*'는 공백 하나로 이어서 한 단어
+//# % / 연산은 원소마다 따로
+static int	append_whole(t_exp *exp_data, t_brace *br, t_array *arr,
+				t_envp *envp_lst)
+{
+	t_aiter	it;
+	char	*val;
+	int		n;
+	int		ok;
+
+	ft_memset(&it, 0, sizeof(t_aiter));
+	n = 0;
+	ok = 1;
+	while (ok && arr && array_next(arr, &it))
+	{
+		if (n++ && br->sub[0] == '*')
+			ok = exp_append_expanded(exp_data, " ");
+		else if (n > 1)
+			ok = exp_append_mark(exp_data, MASK_BREAK);
+		br->elem = it.value;
+		if (br->keys)
+			br->elem = it.key;
+		val = apply_brace(br, envp_lst);
+		ok = (ok && val && exp_append_expanded(exp_data, val));
+		free(val);
+	}
+	if (ok && n == 0 && br->sub[0] == '@')
+		ok = exp_append_mark(exp_data, MASK_VANISH);
+	return (ok);
+}
+
+//${#a[@]}는 원소 수, 원소 전체는 append_whole, 나머지는 값 하나
+int	exp_brace_append(t_exp *exp_data, t_brace *br, t_envp *envp_lst)
+{
+	t_array	*arr;
+	char	*result;
+	int		ret;
+
+	if (br->sub && br->sub_len == 1
+		&& (br->sub[0] == '@' || br->sub[0] == '*'))
+	{
+		arr = find_array(current_shell(NULL), br->name, br->name_len);
+		if (!br->length)
+			return (append_whole(exp_data, br, arr, envp_lst));
+		if (arr)
+			result = ft_itoa(arr->count);
+		else
+			result = ft_strdup("0");
+	}
+	else
+		result = apply_brace(br, envp_lst);
+	ret = (result && exp_append_expanded(exp_data, result));
+	free(result);
+	return (ret);
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_brace.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 14:06:52 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 14:06:52 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+#include "state.h"
+
+//'${' 다음부터 짝이 맞는 '}' 위치, 없으면 0
+static size_t	find_brace_end(char *value, size_t start)
+{
+	size_t	i;
+	int		depth;
+
+	depth = 1;
+	i = start;
+	while (value[i])
+	{
+		if (value[i] == '{')
+			depth++;
+		else if (value[i] == '}' && --depth == 0)
+			return (i);
+		i++;
+	}
+	return (0);
+}
+
+//연산자 뒤의 단어(와 배열 첨자)도 $확장하고 따옴표를 벗김
+char	*brace_word(const char *s, size_t n, t_envp *envp_lst)
+{
+	char			*word;
+	size_t			i;
+	size_t			j;
+	t_quote_state	state;
+
+	word = ft_substr(s, 0, n);
+	if (!word)
+		return (NULL);
+	s = word;
+	word = expand_process(word, envp_lst);
+	free((char *)s);
+	if (!word)
+		return (NULL);
+	state = STATE_GENERAL;
+	i = 0;
+	j = 0;
+	while (word[i])
+	{
+		if (state_machine(word[i], state) == state)
+			word[j++] = word[i];
+		state = state_machine(word[i++], state);
+	}
+	word[j] = '\0';
+	return (word);
+}
+
+//연산자 뒤 단어, '/' 계열이면 다음 '/' 뒤를 바꿀 문자열로 나눔
+static int	parse_words(const char *s, size_t n, t_brace *br,
+				t_envp *envp_lst)
+{
+	size_t	sep;
+
+	sep = n;
+	if (br->op[0] == '/')
+		sep = 0;
+	while (sep < n && s[sep] != '/')
+		sep++;
+	br->word = brace_word(s, sep, envp_lst);
+	if (br->op[0] == '/' && sep < n)
+		br->rep = brace_word(s + sep + 1, n - sep - 1, envp_lst);
+	else if (br->op[0] == '/')
+		br->rep = ft_strdup("");
+	if (!br->word || (br->op[0] == '/' && !br->rep))
+		return (-1);
+	return (1);
+}
+
+//${#name}, ${name}, ${name op word}, ${name/pat/rep}, ${a[i]}, ${!a[@]} 분해
+//문법 오류 0, 메모리 오류 -1
+static int	parse_brace(const char *body, size_t n, t_brace *br,
+				t_envp *envp_lst)
+{
+	size_t	i;
+	size_t	sep;
+
+	br->length = (n > 1 && body[0] == '#');
+	br->keys = (n > 1 && body[0] == '!');
+	i = br->length + br->keys;
+	br->name = body + i;
+	if (i < n && body[i] == '?')
+		i++;
+	while (i < n && br->name[0] != '?'
+		&& (ft_isalnum(body[i]) || body[i] == '_'))
+		i++;
+	br->name_len = body + i - br->name;
+	i += parse_subscript(body + i, n - i, br);
+	if (br->name_len == 0 || ((br->length || br->keys) && i != n)
+		|| (br->keys && !(br->sub && br->sub_len == 1
+				&& (br->sub[0] == '@' || br->sub[0] == '*'))))
+		return (0);
+	if (i == n)
+		return (1);
+	sep = parse_brace_op(body + i, br->op);
+	if (sep == 0)
+		return (0);
+	return (parse_words(body + i + sep, n - i - sep, br, envp_lst));
+}
+
+//${...} 전체를 fork 없이 여기서 계산해서 붙임
+//닫는 '}'가 없으면 '$'를 글자 그대로 둠
+//bad substitution이면 0 (명령을 실행하지 않음, exp_error에 기록)
+int	exp_brace_process(t_exp *exp_data, char *value, t_envp *envp_lst)
+{
+	size_t	start;
+	t_brace	br;
+	int		ret;
+
+	start = exp_data->idx;
+	exp_data->idx = find_brace_end(value, start + 1);
+	if (!exp_data->idx)
+		return (exp_data->idx = start, sbuf_addc(&exp_data->out, '$')
+			&& sbuf_addc(&exp_data->mask, MASK_LITERAL));
+	ft_memset(&br, 0, sizeof(t_brace));
+	ret = parse_brace(value + start + 1, exp_data->idx - start - 1,
+			&br, envp_lst);
+	exp_data->idx++;
+	if (ret == 0)
+		bad_substitution(value + start - 1, exp_data->idx - start + 1);
+	else if (ret == 1 && !exp_brace_append(exp_data, &br, envp_lst))
+		ret = -1;
+	free(br.word);
+	free(br.rep);
+	return (ret == 1);
+}
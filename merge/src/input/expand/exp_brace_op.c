@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_brace_op.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 15:27:11 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 15:27:11 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "global.h"
+#include "expand.h"
+
+void	bad_substitution(const char *s, size_t n)
+{
+	ft_putstr_fd("minishell: ", 2);
+	write(2, s, n);
+	ft_putendl_fd(": bad substitution", 2);
+	exp_error(1);
+}
+
+//변수 값 복사본 ($?는 종료 코드), unset이면 *set = 0
+//${a[@]#pat}처럼 원소마다 연산하는 중이면 그 원소
+static char	*brace_value(t_brace *br, t_envp *envp_lst, int *set)
+{
+	const char	*v;
+
+	*set = 1;
+	if (br->elem)
+		return (ft_strdup(br->elem));
+	if (br->name[0] == '?')
+		return (ft_itoa(g_exit_status));
+	if (br->sub)
+		v = array_elem(br, envp_lst);
+	else
+		v = lookup_env(br->name, br->name_len, envp_lst);
+	*set = (v != NULL);
+	if (!v)
+		v = "";
+	return (ft_strdup(v));
+}
+
+//:- - 는 값이 없을 때 word, :+ + 는 값이 있을 때 word
+//':'가 붙으면 빈 값도 없는 것으로 봄
+static char	*choose_word(char *val, int set, t_brace *br)
+{
+	int	use_word;
+	int	colon;
+	int	sign;
+
+	colon = (br->op[0] == ':');
+	sign = br->op[colon];
+	use_word = set && !(colon && val[0] == '\0');
+	if (sign == '-')
+		use_word = !use_word;
+	if (!use_word && sign == '-')
+		return (val);
+	free(val);
+	if (!use_word)
+		return (ft_strdup(""));
+	return (ft_strdup(br->word));
+}
+
+//# ## 는 앞에서, % %% 는 뒤에서 패턴과 맞는 부분을 떼어냄 (두번이면 가장 길게)
+static char	*strip_pattern(char *val, t_brace *br)
+{
+	t_pattern	p;
+	long		k;
+	int			flags;
+	size_t		n;
+	char		*res;
+
+	if (!pattern_compile(&p, br->word))
+		return (free(val), NULL);
+	n = ft_strlen(val);
+	flags = 0;
+	if (br->op[1])
+		flags |= MATCH_LONGEST;
+	if (br->op[0] == '%')
+		flags |= MATCH_REVERSE;
+	k = pattern_match_len(&p, val, n, flags);
+	pattern_free(&p);
+	if (k <= 0)
+		return (val);
+	if (br->op[0] == '#')
+		res = ft_strdup(val + k);
+	else
+		res = ft_substr(val, 0, n - k);
+	free(val);
+	return (res);
+}
+
+char	*apply_brace(t_brace *br, t_envp *envp_lst)
+{
+	char	*val;
+	char	*len;
+	int		set;
+
+	val = brace_value(br, envp_lst, &set);
+	if (!val)
+		return (NULL);
+	if (br->length)
+	{
+		len = ft_itoa(ft_strlen(val));
+		free(val);
+		return (len);
+	}
+	if (!br->op[0])
+		return (val);
+	if (br->op[0] == ':' || br->op[0] == '-' || br->op[0] == '+')
+		return (choose_word(val, set, br));
+	if (br->op[0] == '/')
+		return (substitute_pattern(val, br));
+	return (strip_pattern(val, br));
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_brace_sub.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 16:02:45 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 16:02:45 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+
+//지원하는 연산자: :- - :+ + % %% # ## / // /# /%
+//연산자 길이 반환, 모르는 연산자면 0
+size_t	parse_brace_op(const char *s, char op[3])
+{
+	op[0] = s[0];
+	op[1] = '\0';
+	op[2] = '\0';
+	if (s[0] == ':' && (s[1] == '-' || s[1] == '+'))
+		return (op[1] = s[1], 2);
+	if (s[0] == '-' || s[0] == '+')
+		return (1);
+	if ((s[0] == '%' || s[0] == '#') && s[1] == s[0])
+		return (op[1] = s[1], 2);
+	if (s[0] == '%' || s[0] == '#')
+		return (1);
+	if (s[0] == '/' && (s[1] == '/' || s[1] == '#' || s[1] == '%'))
+		return (op[1] = s[1], 2);
+	if (s[0] == '/')
+		return (1);
+	return (0);
+}
+
+//'/#'는 맨 앞, '/%'는 맨 끝에 붙은 가장 긴 매칭만 바꿈
+static int	replace_anchored(t_pattern *p, char *val, t_brace *br,
+				t_sbuf *out)
+{
+	size_t	n;
+	long	k;
+
+	n = ft_strlen(val);
+	if (br->op[1] == '#')
+	{
+		k = pattern_match_len(p, val, n, MATCH_LONGEST);
+		if (k < 0)
+			return (sbuf_append(out, val, n));
+		return (sbuf_append(out, br->rep, ft_strlen(br->rep))
+			&& sbuf_append(out, val + k, n - k));
+	}
+	k = pattern_match_len(p, val, n, MATCH_LONGEST | MATCH_REVERSE);
+	if (k < 0)
+		return (sbuf_append(out, val, n));
+	return (sbuf_append(out, val, n - k)
+		&& sbuf_append(out, br->rep, ft_strlen(br->rep)));
+}
+
+//왼쪽부터 위치마다 가장 긴 매칭을 찾아 rep로 바꿈 ('//'면 끝까지 계속)
+//빈 문자열 매칭은 바꾸지 않음
+static int	replace_scan(t_pattern *p, char *val, t_brace *br, t_sbuf *out)
+{
+	size_t	n;
+	size_t	i;
+	long	k;
+	int		done;
+
+	n = ft_strlen(val);
+	i = 0;
+	done = 0;
+	while (i < n && !done)
+	{
+		k = pattern_match_len(p, val + i, n - i, MATCH_LONGEST);
+		if (k > 0)
+		{
+			if (!sbuf_append(out, br->rep, ft_strlen(br->rep)))
+				return (0);
+			i += k;
+			done = (br->op[1] != '/');
+		}
+		else if (!sbuf_addc(out, val[i++]))
+			return (0);
+	}
+	return (sbuf_append(out, val + i, n - i));
+}
+
+//${v/pat/rep} ${v//pat/rep} ${v/#pat/rep} ${v/%pat/rep}
+char	*substitute_pattern(char *val, t_brace *br)
+{
+	t_pattern	p;
+	t_sbuf		out;
+	int			ok;
+
+	if (!br->word[0])
+		return (val);
+	if (!pattern_compile(&p, br->word))
+		return (free(val), NULL);
+	if (!sbuf_init(&out, ft_strlen(val) + 1))
+		return (pattern_free(&p), free(val), NULL);
+	if (br->op[1] == '#' || br->op[1] == '%')
+		ok = replace_anchored(&p, val, br, &out);
+	else
+		ok = replace_scan(&p, val, br, &out);
+	pattern_free(&p);
+	free(val);
+	if (!ok)
+		return (sbuf_free(&out), NULL);
+	return (out.data);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_cmdsub.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 15:02:44 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 15:02:44 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+#include "output.h"
+
+//'(' 다음부터 짝이 맞는 ')' 위치, 없으면 0
+//따옴표 안의 괄호는 세지 않음
+size_t	find_paren_end(const char *value, size_t start)
+{
+	size_t	i;
+	int		depth;
+	char	quote;
+
+	depth = 1;
+	quote = 0;
+	i = start;
+	while (value[i])
+	{
+		if (quote && value[i] == quote)
+			quote = 0;
+		else if (!quote && (value[i] == '\'' || value[i] == '"'))
+			quote = value[i];
+		else if (!quote && value[i] == '(')
+			depth++;
+		else if (!quote && value[i] == ')' && --depth == 0)
+			return (i);
+		i++;
+	}
+	return (0);
+}
+
+//$( 명령 )을 실행해서 출력으로 바꿈 (끝의 개행 제거)
+//따옴표 밖이면 결과가 MASK_UNQUOTED라 field splitting 대상이 됨
+int	exp_cmdsub_process(t_exp *exp_data, char *value)
+{
+	size_t	start;
+	char	*body;
+	char	*result;
+	int		ret;
+
+	start = exp_data->idx + 1;
+	exp_data->idx = find_paren_end(value, start);
+	if (!exp_data->idx)
+		return (exp_data->idx = start - 1, sbuf_addc(&exp_data->out, '$')
+			&& sbuf_addc(&exp_data->mask, MASK_LITERAL));
+	body = ft_substr(value, start, exp_data->idx - start);
+	exp_data->idx++;
+	if (!body)
+		return (0);
+	result = command_output(body);
+	free(body);
+	if (!result)
+		return (0);
+	ret = exp_append_expanded(exp_data, result);
+	free(result);
+	return (ret);
+}
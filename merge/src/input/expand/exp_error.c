@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_error.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:40 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:40 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "expand.h"
+
+//확장을 멈춘 오류(bad substitution, 산술 오류)가 났는지, 메세지는 이미 나감
+//set이 1이면 기록, -1이면 확인하고 지움, 0이면 확인만
+int	exp_error(int set)
+{
+	static int	failed;
+	int			ret;
+
+	ret = (failed || set == 1);
+	if (set == 1)
+		failed = 1;
+	else if (set == -1)
+		failed = 0;
+	return (ret);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_param.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 10:12:40 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 10:12:40 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "global.h"
+#include "expand.h"
+#include "output.h"
+
+static int	append_number(t_exp *exp_data, int n)
+{
+	char	*s;
+	int		ret;
+
+	s = ft_itoa(n);
+	ret = (s && exp_append_expanded(exp_data, s));
+	free(s);
+	return (ret);
+}
+
+//"$@", "${a[@]}"에서 원소 사이는 따옴표를 닫고 MASK_BREAK 글자를 넣고 다시 엶
+//(빈 원소도 "" 단어로 남고, IFS와 상관없이 여기서 단어가 나뉨)
+//원소가 하나도 없으면 MASK_VANISH를 넣어서 "" 단어까지 없어지게 함
+//word가 아니면(herdoc 본문 등) 예전처럼 공백 하나로 이어붙임
+int	exp_append_mark(t_exp *exp_data, char mark)
+{
+	int	quoted;
+
+	if (!exp_data->word)
+		return (mark == MASK_VANISH || exp_append_expanded(exp_data, " "));
+	quoted = (exp_data->state == STATE_IN_DQUOTE);
+	if (mark == MASK_VANISH && !quoted)
+		return (1);
+	if (quoted && mark == MASK_BREAK && !(sbuf_addc(&exp_data->out, '"')
+			&& sbuf_addc(&exp_data->mask, MASK_LITERAL)))
+		return (0);
+	if (!sbuf_addc(&exp_data->out, ' ') || !sbuf_addc(&exp_data->mask, mark))
+		return (0);
+	if (quoted && mark == MASK_BREAK)
+		return (sbuf_addc(&exp_data->out, '"')
+			&& sbuf_addc(&exp_data->mask, MASK_LITERAL));
+	return (1);
+}
+
+//$@는 인자마다 단어, $*는 공백 하나로 이어붙임
+static int	append_all_params(t_exp *exp_data, t_shell *shell, char c)
+{
+	int	i;
+
+	i = 1;
+	while (i <= shell->param_count)
+	{
+		if (i > 1 && c == '*' && !exp_append_expanded(exp_data, " "))
+			return (0);
+		if (i > 1 && c == '@' && !exp_append_mark(exp_data, MASK_BREAK))
+			return (0);
+		if (!exp_append_expanded(exp_data, shell->params[i]))
+			return (0);
+		i++;
+	}
+	if (shell->param_count == 0 && c == '@')
+		return (exp_append_mark(exp_data, MASK_VANISH));
+	return (1);
+}
+
+//$0, $1, ${10}: 숫자로만 된 이름, 인자 수를 넘으면 NULL (unset과 같음)
+const char	*positional_param(const char *p, size_t len)
+{
+	t_shell	*shell;
+	size_t	n;
+
+	shell = current_shell(NULL);
+	if (!shell || !shell->params)
+		return (NULL);
+	n = 0;
+	while (len--)
+	{
+		n = n * 10 + (*p++ - '0');
+		if (n > (size_t)shell->param_count)
+			return (NULL);
+	}
+	return (shell->params[n]);
+}
+
+//$?, $#, $@, $*, $0~$9 (숫자는 한 글자만), idx는 '$' 다음 글자
+int	exp_param_process(t_exp *exp_data, char *value)
+{
+	t_shell		*shell;
+	char		c;
+	const char	*param;
+
+	shell = current_shell(NULL);
+	c = value[exp_data->idx++];
+	if (c == '?')
+		return (append_number(exp_data, g_exit_status));
+	if (c == '#')
+		return (append_number(exp_data, shell->param_count));
+	if (c == '@' || c == '*')
+		return (append_all_params(exp_data, shell, c));
+	param = positional_param(&c, 1);
+	if (!param)
+		return (1);
+	return (exp_append_expanded(exp_data, param));
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_procsub.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 10:41:27 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 10:41:27 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+#include "output.h"
+
+//<( 명령 ) 이나 >( 명령 )을 백그라운드로 띄우고 /dev/fd/N 경로로 바꿈
+//경로는 한 단어 그대로 (나누거나 glob 하지 않음)
+int	exp_procsub_process(t_exp *exp_data, char *value)
+{
+	size_t	start;
+	size_t	end;
+	char	*body;
+	char	*path;
+	int		ret;
+
+	start = exp_data->idx + 2;
+	end = find_paren_end(value, start);
+	if (!end)
+	{
+		if (!exp_normal_process(exp_data, value))
+			return (0);
+		exp_data->idx++;
+		return (1);
+	}
+	body = ft_substr(value, start, end - start);
+	if (!body)
+		return (0);
+	path = process_subst(body, value[exp_data->idx] == '>');
+	free(body);
+	exp_data->idx = end + 1;
+	if (!path)
+		return (0);
+	ret = exp_append_quoted(exp_data, path);
+	free(path);
+	return (ret);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exp_tilde.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 17:12:48 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 17:12:48 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "expand.h"
+
+//~ 뒤 '/' 전까지가 tilde-prefix, 따옴표나 $가 섞여 있으면 확장하지 않음
+static size_t	prefix_len(const char *value)
+{
+	size_t	i;
+
+	i = 1;
+	while (value[i] && value[i] != '/')
+	{
+		if (ft_strchr("'\"\\$", value[i]))
+			return (0);
+		i++;
+	}
+	return (i);
+}
+
+//tilde나 /dev/fd 경로처럼 따옴표 안에서 나온 것처럼 다룰 결과 (MASK_QUOTED)
+//(홈 디렉토리에 공백이나 *가 있어도 다시 나누거나 glob 하지 않음)
+int	exp_append_quoted(t_exp *exp_data, const char *s)
+{
+	size_t	len;
+
+	len = ft_strlen(s);
+	if (!sbuf_append(&exp_data->out, s, len)
+		|| !sbuf_reserve(&exp_data->mask, len))
+		return (0);
+	ft_memset(exp_data->mask.data + exp_data->mask.len, MASK_QUOTED, len);
+	exp_data->mask.len += len;
+	exp_data->mask.data[exp_data->mask.len] = '\0';
+	return (1);
+}
+
+//단어 맨 앞의 ~, ~+, ~-, ~user
+//~는 cd와 같이 환경변수 HOME에서, ~user는 passwd 캐시에서 찾음
+//HOME이 없거나 모르는 사용자면 idx를 그대로 두어 글자 그대로 남김
+int	exp_tilde_process(t_exp *exp_data, char *value, t_envp *envp_lst)
+{
+	size_t		len;
+	const char	*dir;
+
+	len = prefix_len(value);
+	if (len == 0)
+		return (1);
+	dir = NULL;
+	if (len == 1)
+		dir = lookup_env("HOME", 4, envp_lst);
+	else if (len == 2 && value[1] == '+')
+		dir = lookup_env("PWD", 3, envp_lst);
+	else if (len == 2 && value[1] == '-')
+		dir = lookup_env("OLDPWD", 6, envp_lst);
+	else if (!pw_home(value + 1, len - 1, &dir))
+		return (0);
+	if (!dir)
+		return (1);
+	exp_data->idx = len;
+	return (exp_append_quoted(exp_data, dir));
+}
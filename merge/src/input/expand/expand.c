@@ -16,75 +16,85 @@
 #include "libft.h"
 #include "state.h"
 #include "global.h"
+#include "split_word.h"
+
+//글자 하나, 또는 $... 나 <( ) 덩어리 하나를 처리
+//word가 아니면(herdoc 본문 등) 프로세스 치환은 하지 않음
+static int	expand_step(t_exp *exp_data, char *value, t_envp *envp_lst,
+		int word)
+{
+	if (is_valid_expand(exp_data, value))
+		return (exp_env_process(exp_data, value, envp_lst));
+	if (word && exp_data->state == STATE_GENERAL
+		&& is_procsub(value + exp_data->idx))
+		return (exp_procsub_process(exp_data, value));
+	if (is_quote(value[exp_data->idx]))
+		exp_data->state = state_machine(value[exp_data->idx],
+				exp_data->state);
+	if (!exp_normal_process(exp_data, value))
+		return (0);
+	exp_data->idx++;
+	return (1);
+}
 
 //확장로직
+//결과 문자열과 같은 길이의 mask에 글자마다 출처를 기록
+//tilde는 명령줄의 단어에서만 (herdoc 본문이나 ${v:-word} 안은 제외)
+static int	expand_with_mask(char *value, t_envp *envp_lst, t_exp *exp_data,
+		int word)
+{
+	if (!set_exp_data(exp_data))
+		return (0);
+	exp_data->word = word;
+	if (word && value[0] == '~'
+		&& !exp_tilde_process(exp_data, value, envp_lst))
+		return (sbuf_free(&exp_data->out), sbuf_free(&exp_data->mask), 0);
+	while (value[exp_data->idx])
+	{
+		if (!expand_step(exp_data, value, envp_lst, word))
+			return (sbuf_free(&exp_data->out),
+				sbuf_free(&exp_data->mask), 0);
+	}
+	return (1);
+}
+
 char	*expand_process(char *value, t_envp *envp_lst)
 {
 	t_exp	exp_data;
 
-	if (!set_exp_data(&exp_data))
+	if (!expand_with_mask(value, envp_lst, &exp_data, 0))
 		return (NULL);
-	while (value[exp_data.idx])
-	{
-		if (is_valid_expand(&exp_data, value))
-		{
-			if (!exp_env_process(&exp_data, value, envp_lst))
-				return (NULL);
-			continue ;
-		}
-		if (is_quote(value[exp_data.idx]))
-			exp_data.state = state_machine(value[exp_data.idx], exp_data.state);
-		if (!exp_normal_process(&exp_data, value))
-			return (NULL);
-		exp_data.idx++;
-	}
-	return (exp_data.result);
+	sbuf_free(&exp_data.mask);
+	return (exp_data.out.data);
 }
 
 static int	expand_word_token(t_token *curr, t_envp *envp_lst)
 {
-	char	*temp;
+	t_exp	exp_data;
 
 	if (!curr || !curr->value || !envp_lst || curr->type == T_END)
 	{
 		perror("unexpected error : expand_word_token");
 		return (0);
 	}
-	temp = expand_process(curr->value, envp_lst);
-	if (!temp)
+	if (!expand_with_mask(curr->value, envp_lst, &exp_data, 1))
 	{
-		perror("malloc fail : expand_process");
+		if (!exp_error(0))
+			perror("malloc fail : expand_process");
 		return (0);
 	}
-	free (curr->value);
-	curr->value = temp;
+	free(curr->value);
+	curr->value = exp_data.out.data;
+	free(curr->mask);
+	curr->mask = exp_data.mask.data;
 	return (1);
 }
 
-int	has_whitespace(const char *s)
-{
-	t_quote_state	state;
-	size_t			i;
-
-	if (!s)
-		return (0);
-	state = STATE_GENERAL;
-	i = 0;
-	while (s[i])
-	{
-		if (state == STATE_GENERAL && is_space((unsigned char)s[i]))
-			return (1);
-		if (s[i] == '\'' || s[i] == '"')
-			state = state_machine(s[i], state);
-		i++;
-	}
-	return (0);
-}
-
 typedef struct s_expand_ctx
 {
-	int	do_check_filename;
-	int	ambiguous_printed;
+	int			do_check_filename;
+	int			ambiguous_printed;
+	const char	*ifs;
 }	t_expand_ctx;
 
 static void	print_ambiguous_error(char *value)
@@ -94,31 +104,46 @@ static void	print_ambiguous_error(char *value)
 	ft_putendl_fd(": ambiguous redirect", 2);
 }
 
-//quote 일반 상태일때 whitespcae 존재시 파일문법 오류
+//field splitting 했을 때 필드가 정확히 하나가 아니면 파일문법 오류
+//here-string(do_check_filename == 2)은 나누지 않고 통째로 한 단어
+static void	check_filename(t_token *curr, char *orig_value, t_expand_ctx *ctx)
+{
+	if (!ctx->do_check_filename)
+		return ;
+	if (ctx->do_check_filename == 1 && count_fields(curr, ctx->ifs) != 1)
+	{
+		curr->type = T_WRONG_FILNAME;
+		if (!ctx->ambiguous_printed)
+		{
+			print_ambiguous_error(orig_value);
+			ctx->ambiguous_printed = 1;
+		}
+	}
+	else
+		curr->type = T_CORRECT_FILNAME;
+	ctx->do_check_filename = 0;
+}
+
+//'$', '<(', '>(', 맨 앞 '~'가 없는 단어는 확장해도 그대로라 복사 없이 건너뜀
 static int	handle_word(t_token *curr, t_envp *envp_lst, t_expand_ctx *ctx)
 {
 	char	*orig_value;
 
+	if (!ft_strchr(curr->value, '$') && curr->value[0] != '~'
+		&& !ft_strnstr(curr->value, "<(", ft_strlen(curr->value))
+		&& !ft_strnstr(curr->value, ">(", ft_strlen(curr->value)))
+	{
+		if (ctx->do_check_filename)
+			curr->type = T_CORRECT_FILNAME;
+		ctx->do_check_filename = 0;
+		return (1);
+	}
 	orig_value = ft_strdup(curr->value);
 	if (!orig_value)
 		return (0);
 	if (!expand_word_token(curr, envp_lst))
 		return (free(orig_value), 0);
-	if (ctx->do_check_filename)
-	{
-		if (curr->value[0] == '\0' || has_whitespace(curr->value))
-		{
-			curr->type = T_WRONG_FILNAME;
-			if (!ctx->ambiguous_printed)
-			{
-				print_ambiguous_error(orig_value);
-				ctx->ambiguous_printed = 1;
-			}
-		}
-		else
-			curr->type = T_CORRECT_FILNAME;
-		ctx->do_check_filename = 0;
-	}
+	check_filename(curr, orig_value, ctx);
 	free(orig_value);
 	return (1);
 }
@@ -126,21 +151,23 @@ static int	handle_word(t_token *curr, t_envp *envp_lst, t_expand_ctx *ctx)
 //변수 확장 및 filename 타입 세팅
 //파일이름 문법 오류시 에러메세지 파이프 별로 하나씩 출력
 //잘못된 파일인 경우 token type으로 명시
+//bad substitution 등 확장 오류는 exp_error에 남겨서 부른 쪽이 명령을 건너뜀
 int	expand_token(t_token *token_lst, t_envp *envp_lst)
 {
 	t_token			*curr;
 	t_expand_ctx	ctx;
 
+	exp_error(-1);
 	curr = token_lst;
 	ctx.do_check_filename = 0;
 	ctx.ambiguous_printed = 0;
+	ctx.ifs = get_ifs(envp_lst);
 	while (curr && curr->type != T_END)
 	{
 		if (curr->type == T_HEREDOC)
 			curr = curr->next;
-		else if (curr->type == T_REDIR_IN || curr->type == T_REDIR_OUT
-			|| curr->type == T_APPEND)
-			ctx.do_check_filename = 1;
+		else if (is_redir_type(curr->type))
+			ctx.do_check_filename = 1 + (curr->type == T_HERESTRING);
 		else if (curr->type == T_WORD)
 		{
 			if (!handle_word(curr, envp_lst, &ctx))
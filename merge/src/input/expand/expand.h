@@ -16,12 +16,83 @@
 # include "utils.h"
 # include <stdlib.h>
 # include <stdio.h>
+# include <time.h>
+# define PW_CACHE_TTL 30
+# define PW_CACHE_MAX 32
+
+//${name op word} 하나를 쪼갠 결과, word/rep는 확장이 끝난 문자열
+//sub는 name[...]의 확장 전 첨자, keys는 ${!a[@]}, elem은 원소마다 연산할 때의 값
+typedef struct s_brace
+{
+	const char	*name;
+	size_t		name_len;
+	int			length;
+	char		op[3];
+	char		*word;
+	char		*rep;
+	const char	*sub;
+	size_t		sub_len;
+	int			keys;
+	const char	*elem;
+}	t_brace;
+
+//~user 조회 결과, dir이 NULL이면 없는 사용자 (실패도 TTL 동안 기억)
+typedef struct s_pw_cache
+{
+	t_lru	lru;
+	char	*dir;
+	time_t	stamp;
+}	t_pw_cache;
 
 //exp.c
+const char		*lookup_env(const char *p, size_t len, t_envp *envp_lst);
+int				exp_append_expanded(t_exp *exp_data, const char *s);
 int				set_exp_data(t_exp *exp_data);
 int				exp_normal_process(t_exp *exp_data, char *value);
 int				exp_env_process(t_exp *exp_data, char *value, t_envp *envp_lst);
 
+//exp_param.c
+const char		*positional_param(const char *p, size_t len);
+int				exp_param_process(t_exp *exp_data, char *value);
+int				exp_append_mark(t_exp *exp_data, char mark);
+
+//exp_brace.c, exp_brace_op.c, exp_brace_sub.c
+int				exp_brace_process(t_exp *exp_data, char *value,
+					t_envp *envp_lst);
+char			*apply_brace(t_brace *br, t_envp *envp_lst);
+void			bad_substitution(const char *s, size_t n);
+size_t			parse_brace_op(const char *s, char op[3]);
+char			*substitute_pattern(char *val, t_brace *br);
+char			*brace_word(const char *s, size_t n, t_envp *envp_lst);
+
+//exp_array.c
+size_t			parse_subscript(const char *s, size_t n, t_brace *br);
+int				subscript_index(t_array *arr, const char *key,
+					t_envp *envp_lst, size_t *i);
+const char		*array_elem(t_brace *br, t_envp *envp_lst);
+int				exp_brace_append(t_exp *exp_data, t_brace *br,
+					t_envp *envp_lst);
+
+//exp_error.c
+int				exp_error(int set);
+
+//exp_arith.c
+int				exp_arith_process(t_exp *exp_data, char *value,
+					t_envp *envp_lst);
+
+//exp_cmdsub.c, exp_procsub.c (is_procsub은 lexing/word_part.c)
+size_t			find_paren_end(const char *value, size_t start);
+int				exp_cmdsub_process(t_exp *exp_data, char *value);
+int				exp_procsub_process(t_exp *exp_data, char *value);
+int				is_procsub(char *s);
+
+//exp_tilde.c, pw_cache.c
+int				exp_tilde_process(t_exp *exp_data, char *value,
+					t_envp *envp_lst);
+int				exp_append_quoted(t_exp *exp_data, const char *s);
+int				pw_home(const char *name, size_t len, const char **dir);
+void			clear_pw_cache(t_lru **cache);
+
 //expand.c
 char			*expand_process(char *value, t_envp *envp_lst);
 int				expand_token(t_token *token_lst, t_envp *envp_lst);
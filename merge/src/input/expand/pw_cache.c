@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pw_cache.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 17:20:05 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 17:20:05 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <pwd.h>
+#include "libft.h"
+#include "expand.h"
+#include "list.h"
+
+static void	delone_pw_cache(t_lru *node)
+{
+	free(node->key);
+	free(((t_pw_cache *)node)->dir);
+	free(node);
+}
+
+//맨 앞에 새 항목을 넣고 PW_CACHE_MAX를 넘는 가장 오래된 항목은 버림
+static t_pw_cache	*new_entry(t_lru **head, const char *name, size_t len)
+{
+	t_pw_cache	*entry;
+	char		*key;
+
+	entry = malloc(sizeof(t_pw_cache));
+	key = ft_substr(name, 0, len);
+	if (!entry || !key)
+		return (free(entry), free(key), NULL);
+	ft_memset(entry, 0, sizeof(t_pw_cache));
+	lru_key(&entry->lru, key, len);
+	lru_push(head, &entry->lru, PW_CACHE_MAX, delone_pw_cache);
+	return (entry);
+}
+
+//NSS에 다시 물어봄, 없는 사용자도 dir = NULL로 시간을 찍어 둠
+static int	refresh(t_pw_cache *entry, time_t now)
+{
+	struct passwd	*pw;
+	char			*dir;
+
+	pw = getpwnam(entry->lru.key);
+	dir = NULL;
+	if (pw && pw->pw_dir)
+	{
+		dir = ft_strdup(pw->pw_dir);
+		if (!dir)
+			return (0);
+	}
+	free(entry->dir);
+	entry->dir = dir;
+	entry->stamp = now;
+	return (1);
+}
+
+//세션 동안 유지되는 ~user 캐시 (getpwnam은 NSS 설정에 따라 느릴 수 있음)
+//캐시는 t_shell에 있음 (확장 함수들이 t_shell을 받지 않으므로 current_shell로)
+//name의 홈 디렉토리를 dir에 (없는 사용자면 NULL), 메모리 오류면 0
+int	pw_home(const char *name, size_t len, const char **dir)
+{
+	t_lru		**head;
+	t_pw_cache	*entry;
+	time_t		now;
+
+	head = &current_shell(NULL)->pw_cache;
+	entry = (t_pw_cache *)lru_find(head, name, len);
+	now = time(NULL);
+	if (!entry)
+	{
+		entry = new_entry(head, name, len);
+		if (!entry || !refresh(entry, now))
+			return (0);
+	}
+	else if (now - entry->stamp >= PW_CACHE_TTL && !refresh(entry, now))
+		return (0);
+	*dir = entry->dir;
+	return (1);
+}
+
+void	clear_pw_cache(t_lru **cache)
+{
+	lru_trim(cache, 0, delone_pw_cache);
+}
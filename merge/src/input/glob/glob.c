@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 11:25:36 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 11:25:36 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "glob.h"
+#include "list.h"
+
+//따옴표 밖의 *, ?, [ 가 있는 단어인지
+//(remove_quote가 따옴표 안에 있던 글자를 MASK_QUOTED로 표시해 둠)
+static int	is_glob_word(t_token *tok)
+{
+	size_t	i;
+
+	i = 0;
+	while (tok->value[i])
+	{
+		if ((tok->value[i] == '*' || tok->value[i] == '?'
+				|| tok->value[i] == '[')
+			&& (!tok->mask || tok->mask[i] != MASK_QUOTED))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+//따옴표 안에서 온 특수문자는 '\'를 붙여서 글자 그대로 매칭되게
+char	*build_pattern(t_token *tok)
+{
+	t_sbuf	sb;
+	size_t	i;
+	int		ok;
+
+	if (!sbuf_init(&sb, ft_strlen(tok->value) * 2 + 1))
+		return (NULL);
+	ok = 1;
+	i = 0;
+	while (ok && tok->value[i])
+	{
+		if (tok->mask && tok->mask[i] == MASK_QUOTED
+			&& ft_strchr("*?[]\\", tok->value[i]))
+			ok = sbuf_addc(&sb, '\\');
+		if (ok)
+			ok = sbuf_addc(&sb, tok->value[i]);
+		i++;
+	}
+	if (!ok)
+		return (sbuf_free(&sb), NULL);
+	return (sb.data);
+}
+
+//첫 결과는 원래 토큰 자리에, 나머지는 바로 뒤에 새 WORD 토큰으로
+static int	splice_matches(t_token *tok, t_strvec *v)
+{
+	t_token	*new_token;
+	size_t	i;
+
+	free(tok->value);
+	free(tok->mask);
+	tok->mask = NULL;
+	tok->value = v->items[0];
+	v->items[0] = NULL;
+	i = v->count;
+	while (--i > 0)
+	{
+		new_token = create_token(v->items[i], T_WORD);
+		if (!new_token)
+			return (0);
+		v->items[i] = NULL;
+		new_token->next = tok->next;
+		tok->next = new_token;
+	}
+	return (1);
+}
+
+//단어 하나를 정렬된 경로들로 바꿈, 맞는게 없으면 그대로 둠
+//바뀐 뒤의 토큰 수 반환 (메모리 오류면 -1)
+static long	glob_word(t_token *tok, t_dir_cache **cache)
+{
+	char		*pat;
+	t_strvec	v;
+	int			ok;
+	long		count;
+
+	pat = build_pattern(tok);
+	if (!pat)
+		return (-1);
+	ft_memset(&v, 0, sizeof(t_strvec));
+	ok = glob_pattern(pat, cache, &v);
+	free(pat);
+	if (ok && v.count > 1)
+		ok = sort_strings(v.items, v.count);
+	if (ok && v.count)
+		ok = splice_matches(tok, &v);
+	count = v.count + (v.count == 0);
+	strvec_free(&v);
+	if (!ok)
+		return (-1);
+	return (count);
+}
+
+//quote 제거까지 끝난 WORD들의 pathname expansion
+//디렉토리 목록은 이 줄을 처리하는 동안만 캐시 (*.c *.h 가 같은 readdir을 씀)
+int	glob_expand(t_token *token_lst)
+{
+	t_dir_cache	*cache;
+	t_token		*curr;
+	long		n;
+
+	cache = NULL;
+	curr = token_lst;
+	n = 0;
+	while (curr && curr->type != T_END && n >= 0)
+	{
+		if (curr->type == T_HEREDOC && curr->next)
+			curr = curr->next;
+		else if (curr->type == T_WORD && curr->value && is_glob_word(curr))
+		{
+			n = glob_word(curr, &cache);
+			while (n > 1 && n--)
+				curr = curr->next;
+		}
+		curr = curr->next;
+	}
+	dir_cache_clear(&cache);
+	return (n >= 0);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:03:21 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 10:03:21 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GLOB_H
+# define GLOB_H
+# include "types.h"
+# include "libft.h"
+# include "utils.h"
+
+//디렉토리 항목 하나, is_dir이 -1이면 아직 모름 (필요할 때 stat)
+typedef struct s_dent
+{
+	char	*name;
+	int		is_dir;
+}	t_dent;
+
+//한 줄을 globbing 하는 동안 읽은 디렉토리 목록
+//같은 디렉토리를 여러 패턴이 봐도 readdir은 한번만
+typedef struct s_dir_cache
+{
+	char				*path;
+	t_dent				*ents;
+	size_t				count;
+	size_t				cap;
+	struct s_dir_cache	*next;
+}	t_dir_cache;
+
+typedef struct s_strvec
+{
+	char	**items;
+	size_t	count;
+	size_t	cap;
+}	t_strvec;
+
+//패턴을 '/' 단위로 한 단계씩 펼칠 때의 상태
+typedef struct s_glob
+{
+	t_dir_cache	**cache;
+	t_strvec	cur;
+	t_strvec	next;
+	int			used_glob;
+}	t_glob;
+
+//glob_dir.c
+t_dir_cache	*dir_cache_get(t_dir_cache **cache, const char *path);
+int			dent_is_dir(t_dir_cache *dir, t_dent *ent);
+void		dir_cache_clear(t_dir_cache **cache);
+
+//glob_vec.c
+int			strvec_push(t_strvec *v, char *s);
+void		strvec_free(t_strvec *v);
+int			sort_strings(char **arr, size_t n);
+
+//glob_path.c, glob.c
+int			glob_pattern(const char *pat, t_dir_cache **cache, t_strvec *out);
+int			glob_expand(t_token *token_lst);
+char		*build_pattern(t_token *tok);
+
+#endif
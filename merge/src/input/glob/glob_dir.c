@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_dir.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:21:47 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 10:21:47 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "glob.h"
+#include <dirent.h>
+#include <sys/stat.h>
+
+//'.'과 '..'은 넣지 않음
+static int	push_entry(t_dir_cache *dir, struct dirent *ent)
+{
+	t_dent	*grown;
+
+	if (ent->d_name[0] == '.' && (!ent->d_name[1]
+			|| (ent->d_name[1] == '.' && !ent->d_name[2])))
+		return (1);
+	if (dir->count == dir->cap)
+	{
+		grown = malloc(sizeof(t_dent) * (dir->cap * 2 + 16));
+		if (!grown)
+			return (0);
+		if (dir->count)
+			ft_memcpy(grown, dir->ents, sizeof(t_dent) * dir->count);
+		free(dir->ents);
+		dir->ents = grown;
+		dir->cap = dir->cap * 2 + 16;
+	}
+	dir->ents[dir->count].name = ft_strdup(ent->d_name);
+	if (!dir->ents[dir->count].name)
+		return (0);
+	dir->ents[dir->count].is_dir = -1;
+	if (ent->d_type == DT_DIR)
+		dir->ents[dir->count].is_dir = 1;
+	else if (ent->d_type != DT_LNK && ent->d_type != DT_UNKNOWN)
+		dir->ents[dir->count].is_dir = 0;
+	dir->count++;
+	return (1);
+}
+
+//열 수 없는 디렉토리는 빈 목록
+static int	read_dir(t_dir_cache *dir)
+{
+	DIR				*dp;
+	struct dirent	*ent;
+
+	if (dir->path[0])
+		dp = opendir(dir->path);
+	else
+		dp = opendir(".");
+	if (!dp)
+		return (1);
+	ent = readdir(dp);
+	while (ent)
+	{
+		if (!push_entry(dir, ent))
+			return (closedir(dp), 0);
+		ent = readdir(dp);
+	}
+	closedir(dp);
+	return (1);
+}
+
+//path는 "" (현재 디렉토리) 이거나 '/'로 끝나는 경로
+//처음 보는 디렉토리만 readdir, 메모리 오류면 NULL
+t_dir_cache	*dir_cache_get(t_dir_cache **cache, const char *path)
+{
+	t_dir_cache	*dir;
+
+	dir = *cache;
+	while (dir && ft_strcmp(dir->path, (char *)path) != 0)
+		dir = dir->next;
+	if (dir)
+		return (dir);
+	dir = ft_calloc(1, sizeof(t_dir_cache));
+	if (!dir)
+		return (NULL);
+	dir->path = ft_strdup(path);
+	dir->next = *cache;
+	*cache = dir;
+	if (!dir->path || !read_dir(dir))
+		return (NULL);
+	return (dir);
+}
+
+//d_type으로 모르는 것(심볼릭 링크 등)만 stat으로 확인하고 결과를 기억
+int	dent_is_dir(t_dir_cache *dir, t_dent *ent)
+{
+	struct stat	st;
+	char		*full;
+
+	if (ent->is_dir != -1)
+		return (ent->is_dir);
+	full = ft_strjoin(dir->path, ent->name);
+	if (!full)
+		return (0);
+	ent->is_dir = (stat(full, &st) == 0 && S_ISDIR(st.st_mode));
+	free(full);
+	return (ent->is_dir);
+}
+
+void	dir_cache_clear(t_dir_cache **cache)
+{
+	t_dir_cache	*next;
+	size_t		i;
+
+	while (*cache)
+	{
+		next = (*cache)->next;
+		i = 0;
+		while (i < (*cache)->count)
+			free((*cache)->ents[i++].name);
+		free((*cache)->ents);
+		free((*cache)->path);
+		free(*cache);
+		*cache = next;
+	}
+}
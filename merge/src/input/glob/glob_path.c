@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_path.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 11:02:58 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 11:02:58 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "glob.h"
+#include <sys/stat.h>
+
+//prefix + name (+ '/')
+static char	*join_path(const char *prefix, const char *name, int slash)
+{
+	char	*path;
+	size_t	plen;
+	size_t	nlen;
+
+	plen = ft_strlen(prefix);
+	nlen = ft_strlen(name);
+	path = malloc(plen + nlen + 2);
+	if (!path)
+		return (NULL);
+	ft_memcpy(path, prefix, plen);
+	ft_memcpy(path + plen, name, nlen);
+	path[plen + nlen] = '/';
+	path[plen + nlen + slash] = '\0';
+	return (path);
+}
+
+//특수문자 없는 조각은 readdir 없이 그대로 붙임
+//glob 뒤에 오는 마지막 조각만 실제로 있는지 확인 (*/Makefile 같은 경우)
+static int	push_literal(t_glob *g, const char *prefix, const char *lit,
+				int last)
+{
+	struct stat	st;
+	char		*path;
+
+	path = join_path(prefix, lit, !last);
+	if (!path)
+		return (0);
+	if (last && g->used_glob && lstat(path, &st) != 0)
+		return (free(path), 1);
+	return (strvec_push(&g->next, path));
+}
+
+//prefix 디렉토리에서 패턴과 맞는 이름들, 마지막 조각이 아니면 디렉토리만
+//'.'으로 시작하는 이름은 패턴도 '.'으로 시작할 때만
+static int	match_dir(t_glob *g, const char *prefix, t_pattern *p, int last)
+{
+	t_dir_cache	*dir;
+	size_t		i;
+	int			dot;
+
+	dir = dir_cache_get(g->cache, prefix);
+	if (!dir)
+		return (0);
+	dot = (p->count && p->atoms[0].type == ATOM_CHAR && p->atoms[0].c == '.');
+	i = 0;
+	while (i < dir->count)
+	{
+		if ((dir->ents[i].name[0] != '.' || dot)
+			&& pattern_match(p, dir->ents[i].name)
+			&& (last || dent_is_dir(dir, &dir->ents[i]))
+			&& !strvec_push(&g->next,
+				join_path(prefix, dir->ents[i].name, !last)))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+//'/' 사이 조각 하나를 지금까지의 모든 경로 뒤에 펼침
+static int	glob_step(t_glob *g, const char *comp, int last)
+{
+	t_pattern	p;
+	char		*lit;
+	size_t		i;
+	int			ok;
+
+	if (!pattern_compile(&p, comp))
+		return (0);
+	ok = 1;
+	if (pattern_literal(&p, &lit) && !lit)
+		ok = 0;
+	g->used_glob |= (lit == NULL);
+	i = 0;
+	while (ok && i < g->cur.count)
+	{
+		if (lit)
+			ok = push_literal(g, g->cur.items[i], lit, last);
+		else
+			ok = match_dir(g, g->cur.items[i], &p, last);
+		i++;
+	}
+	free(lit);
+	pattern_free(&p);
+	strvec_free(&g->cur);
+	g->cur = g->next;
+	ft_memset(&g->next, 0, sizeof(t_strvec));
+	return (ok);
+}
+
+//패턴 하나에 맞는 경로들을 out에 (정렬 전), 메모리 오류면 0
+int	glob_pattern(const char *pat, t_dir_cache **cache, t_strvec *out)
+{
+	t_glob	g;
+	size_t	end;
+	char	*comp;
+	int		ok;
+
+	ft_memset(&g, 0, sizeof(t_glob));
+	g.cache = cache;
+	if (*pat == '/')
+		ok = strvec_push(&g.cur, ft_strdup("/"));
+	else
+		ok = strvec_push(&g.cur, ft_strdup(""));
+	pat += (*pat == '/');
+	while (ok && g.cur.count)
+	{
+		end = 0;
+		while (pat[end] && pat[end] != '/')
+			end++;
+		comp = ft_substr(pat, 0, end);
+		ok = (comp && glob_step(&g, comp, pat[end] == '\0'));
+		free(comp);
+		if (!pat[end])
+			break ;
+		pat += end + 1;
+	}
+	*out = g.cur;
+	return (ok);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_vec.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 10:40:09 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/16 10:40:09 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "glob.h"
+
+//s의 소유권을 가져감, 실패하면 s도 해제
+int	strvec_push(t_strvec *v, char *s)
+{
+	char	**grown;
+
+	if (!s)
+		return (0);
+	if (v->count == v->cap)
+	{
+		grown = malloc(sizeof(char *) * (v->cap * 2 + 8));
+		if (!grown)
+			return (free(s), 0);
+		if (v->count)
+			ft_memcpy(grown, v->items, sizeof(char *) * v->count);
+		free(v->items);
+		v->items = grown;
+		v->cap = v->cap * 2 + 8;
+	}
+	v->items[v->count++] = s;
+	return (1);
+}
+
+void	strvec_free(t_strvec *v)
+{
+	while (v->count)
+		free(v->items[--v->count]);
+	free(v->items);
+	v->items = NULL;
+	v->cap = 0;
+}
+
+static size_t	min_size(size_t a, size_t b)
+{
+	if (a < b)
+		return (a);
+	return (b);
+}
+
+//정렬된 두 구간 [lo, end[0])과 [end[0], end[1])을 dst로 합침
+static void	merge_run(char **src, char **dst, size_t lo, size_t end[2])
+{
+	size_t	i;
+	size_t	j;
+	size_t	k;
+
+	i = lo;
+	j = end[0];
+	k = lo;
+	while (k < end[1])
+	{
+		if (i < end[0] && (j >= end[1] || ft_strcmp(src[i], src[j]) <= 0))
+			dst[k++] = src[i++];
+		else
+			dst[k++] = src[j++];
+	}
+}
+
+//bottom-up merge sort, O(n log n)에 같은 이름끼리 순서 유지
+int	sort_strings(char **arr, size_t n)
+{
+	char	**buf[2];
+	size_t	width;
+	size_t	lo;
+	size_t	end[2];
+	int		from;
+
+	buf[0] = arr;
+	buf[1] = malloc(sizeof(char *) * (n + 1));
+	if (!buf[1])
+		return (0);
+	from = 0;
+	width = 1;
+	while (width < n)
+	{
+		lo = 0;
+		while (lo < n)
+		{
+			end[0] = min_size(lo + width, n);
+			end[1] = min_size(lo + 2 * width, n);
+			merge_run(buf[from], buf[!from], lo, end);
+			lo = end[1];
+		}
+		from = !from;
+		width *= 2;
+	}
+	if (from)
+		ft_memcpy(arr, buf[1], sizeof(char *) * n);
+	return (free(buf[1]), 1);
+}
@@ -14,6 +14,7 @@
 #include "utils.h"
 #include "libft.h"
 #include "state.h"
+#include "lexing.h"
 
 static void	print_quote_error(t_quote_state state)
 {
@@ -92,6 +93,8 @@ static t_grammar_status	check_token_error(t_token *token_lst)
 			status = check_pipe(token_lst);
 		else if (is_redir_type(token_lst->type))
 			status = check_redir(token_lst);
+		else if (token_lst->type == T_WORD && is_open_array(token_lst->value))
+			status = GRAMMAR_EOF_ERROR;
 		if (status != GRAMMAR_OK)
 			return (status);
 		token_lst = token_lst->next;
@@ -101,7 +104,7 @@ static t_grammar_status	check_token_error(t_token *token_lst)
 
 // 문법오류 케이스
 // quote 미 닫힘 -> EOF ERROR
-// pipe로 끝나기 -> EOF ERROR
+// pipe로 끝나기, 안닫힌 name=( -> EOF ERROR
 // redir연산자 뒤에 word안오기 및 파이프 연속 -> TOKEN ERROR
 t_grammar_status	grammar_check(t_prompt *prompt)
 {
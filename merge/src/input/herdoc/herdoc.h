@@ -13,7 +13,45 @@
 #ifndef HERDOC_H
 # define HERDOC_H
 # include "types.h"
+# include "utils.h"
+# define HD_FLUSH_SIZE 65536
+# define HD_CACHE_MAX_BODY 1048576
 
-int	heredoc_process(t_prompt *prompt);
+typedef struct s_delim_info
+{
+	char	*cooked_delim;
+	int		quoted_flag;
+}	t_delim_info;
+
+typedef struct s_hd_ctx
+{
+	t_delim_info	info;
+	t_envp			*envp;
+	t_shell			*shell;
+	t_sbuf			src;
+	int				has_dollar;
+	t_sbuf			out;
+	int				fd;
+}	t_hd_ctx;
+
+int				heredoc_process(t_prompt *prompt);
+
+//herdoc_delim.c
+t_delim_info	make_delim(char *raw);
+
+//herdoc_read.c
+int				read_heredoc_body(t_hd_ctx *ctx);
+
+//herdoc_write.c
+int				heredoc_write_body(t_hd_ctx *ctx);
+int				expand_heredocs(t_hd *hd, t_token *words, t_shell *shell);
+
+//herdoc_cache.c
+int				cached_heredoc_fd(t_hd_ctx *ctx);
+
+//herdoc_fd.c
+int				open_heredoc_fd(void);
+int				rewind_heredoc_fd(int fd);
+int				reopen_heredoc_fd(int fd);
 
 #endif
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herdoc_cache.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 16:35:09 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 16:35:09 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "herdoc.h"
+#include "list.h"
+
+//캐시에 넣을 새 memfd를 만들고 본문을 그대로 씀
+static int	write_literal_body(t_hd_ctx *ctx)
+{
+	int	fd;
+
+	fd = open_heredoc_fd();
+	if (fd < 0)
+		return (-1);
+	if (!write_all(fd, ctx->src.data, ctx->src.len))
+		return (close(fd), -1);
+	return (fd);
+}
+
+//본문이 너무 크면 캐시하지 않고 그대로 되감아서 사용
+static int	store_heredoc(t_hd_ctx *ctx, int fd)
+{
+	t_hd_cache	*node;
+
+	if (ctx->src.len > HD_CACHE_MAX_BODY)
+		return (rewind_heredoc_fd(fd));
+	node = create_hd_cache(ctx->src.data, ctx->src.len, fd);
+	if (!node)
+		return (rewind_heredoc_fd(fd));
+	ctx->src.data = NULL;
+	push_hd_cache(&ctx->shell->hd_cache, node);
+	return (reopen_heredoc_fd(fd));
+}
+
+//quoted 구분자거나 '$'가 없는 본문은 내용이 항상 같으므로
+//본문 텍스트를 키로 memfd를 재사용하고, 명령어에는 새로 연 fd를 넘김
+int	cached_heredoc_fd(t_hd_ctx *ctx)
+{
+	t_hd_cache	*hit;
+	int			fd;
+
+	hit = find_hd_cache(&ctx->shell->hd_cache, ctx->src.data, ctx->src.len);
+	if (hit)
+	{
+		ctx->shell->stats.hd_cache_hits++;
+		return (reopen_heredoc_fd(hit->fd));
+	}
+	ctx->shell->stats.hd_cache_misses++;
+	fd = write_literal_body(ctx);
+	if (fd < 0)
+		return (-1);
+	return (store_heredoc(ctx, fd));
+}
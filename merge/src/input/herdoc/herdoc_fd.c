@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herdoc_fd.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/13 14:02:11 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/13 14:02:11 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "herdoc.h"
+#include "libft.h"
+
+//heredoc 본문을 담을 fd 생성
+//memfd가 안되는 환경이면 O_TMPFILE로 대체 (pipe 용량 제한 없음)
+//close-on-exec이라 dup2로 stdin에 붙인 명령어 말고는 물려받지 않음
+//exec 3<file 같은 사용자 fd와 겹치지 않게 SHELL_FD_BASE 위로 옮김
+int	open_heredoc_fd(void)
+{
+	int	fd;
+
+	fd = memfd_create("minishell_heredoc", MFD_CLOEXEC);
+	if (fd < 0)
+		fd = open("/tmp", O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	if (fd < 0)
+		return (-1);
+	return (move_fd_high(fd));
+}
+
+//읽는 쪽에서 처음부터 다시 읽을 수 있도록 offset 되돌리기
+int	rewind_heredoc_fd(int fd)
+{
+	if (fd < 0)
+		return (-1);
+	if (lseek(fd, 0, SEEK_SET) < 0)
+		return (-1);
+	return (fd);
+}
+
+//캐시에 있는 memfd를 offset이 따로인 새 fd로 다시 열기
+//(/proc이 없으면 dup으로 대체, 읽기 전에 executor가 되감음)
+int	reopen_heredoc_fd(int fd)
+{
+	char	*num;
+	char	*path;
+	int		new_fd;
+
+	new_fd = -1;
+	num = ft_itoa(fd);
+	if (!num)
+		return (-1);
+	path = ft_strjoin("/proc/self/fd/", num);
+	free(num);
+	if (path)
+		new_fd = open(path, O_RDONLY | O_CLOEXEC);
+	free(path);
+	if (new_fd < 0)
+		return (fcntl(fd, F_DUPFD_CLOEXEC, SHELL_FD_BASE));
+	return (move_fd_high(new_fd));
+}
@@ -15,149 +15,116 @@
 #include "libft.h"
 #include "expand.h"
 #include "global.h"
-#include <readline/readline.h>
-#include <sys/wait.h>
+#include "herdoc.h"
+#include "ast.h"
 #include <unistd.h>
-#include <signal.h>
 #include <stdlib.h>
-#define DELIM_PRINT "minishell: warning: here-document \
-delimited by end-of-file (wanted `%s')\n"
 
-typedef struct s_delim_info
+//quoted 구분자거나 '$'가 없으면 캐시를 거치고
+//아니면 새 memfd에 '$'가 있는 줄만 확장해서 씀
+static int	heredoc_output_fd(t_hd_ctx *ctx)
 {
-	char	*cooked_delim;
-	int		quoted_flag;
-}	t_delim_info;
-
-static int	detect_quotes(char *str)
-{
-	if (!str)
-		return (0);
-	while (*str)
-	{
-		if (*str == '\'' || *str == '"')
-			return (1);
-		str++;
-	}
-	return (0);
+	if (ctx->info.quoted_flag || !ctx->has_dollar)
+		return (cached_heredoc_fd(ctx));
+	ctx->fd = open_heredoc_fd();
+	if (ctx->fd < 0)
+		return (-1);
+	if (!heredoc_write_body(ctx) || rewind_heredoc_fd(ctx->fd) < 0)
+		return (close(ctx->fd), -1);
+	return (ctx->fd);
 }
 
-static size_t	get_len_without_quotes(char *str)
+//자식 프로세스 없이 현재 프로세스에서 본문을 모두 읽은 뒤 hd->fd를 만듭니다.
+//트리로 실행할 줄(반복, 목록)의 '$'가 있는 본문은 확장하지 않고 원문만 hd->raw에
+//(실행할 때마다 그때의 값으로 expand_heredocs가 만듦)
+//성공 0, 중단되면 exit_status 130으로 -1, 실패 -2
+int	read_heredoc(t_prompt *prompt, t_delim_info delim_info, t_hd *hd)
 {
-	size_t	len;
-
-	len = 0;
-	while (*str)
-	{
-		if (*str != '\'' && *str != '"')
-			len++;
-		str++;
-	}
-	return (len);
-}
+	t_hd_ctx	ctx;
+	int			ret;
 
-static void	copy_without_quotes(char *dest, char *src)
-{
-	while (*src)
+	ctx.info = delim_info;
+	ctx.envp = prompt->shell->envp_list;
+	ctx.shell = prompt->shell;
+	ctx.has_dollar = 0;
+	if (!sbuf_init(&ctx.src, 0))
+		return (-2);
+	ret = read_heredoc_body(&ctx);
+	if (ret == 0 && is_compound_line(prompt->token_lst)
+		&& !ctx.info.quoted_flag && ctx.has_dollar)
+		return (hd->raw = ctx.src.data, 0);
+	if (ret == 0)
+		hd->fd = heredoc_output_fd(&ctx);
+	sbuf_free(&ctx.src);
+	if (ret == 1)
 	{
-		if (*src != '\'' && *src != '"')
-			*dest++ = *src;
-		src++;
+		g_exit_status = 130;
+		return (-1);
 	}
-	*dest = '\0';
-}
-
-t_delim_info	make_delim(char *raw)
-{
-	t_delim_info	info;
-
-	info.cooked_delim = malloc(get_len_without_quotes(raw) + 1);
-	if (!info.cooked_delim)
-		return (info);
-	info.quoted_flag = detect_quotes(raw);
-	copy_without_quotes(info.cooked_delim, raw);
-	return (info);
+	if (hd->fd < 0)
+		return (-2);
+	return (0);
 }
 
-static void	heredoc_child(char *delim, int write_fd, t_envp *envp)
+//herdoc value 처리해서 delim 만들어서 사용
+//성공 1, 실패 0, SIGINT로 중단 -1
+static int	collect_heredoc(t_prompt *prompt, t_token *delim_token)
 {
-	char	*line;
-	char	*expanded;
+	t_delim_info	delim_info;
+	t_hd			*hd;
+	int				ret;
 
-	signal(SIGINT, SIG_DFL);
-	signal(SIGQUIT, SIG_IGN);
-	while (1)
-	{
-		line = readline("> ");
-		if (!line && printf(DELIM_PRINT, delim))
-			break ;
-		if (ft_strcmp(line, delim) == 0)
-		{
-			free(line);
-			break ;
-		}
-		expanded = expand_process(line, envp);
-		if (!expanded)
-			exit(1);
-		free(line);
-		ft_putendl_fd(expanded, write_fd);
-		free(expanded);
-	}
-	close(write_fd);
-	exit(0);
+	delim_info = make_delim(delim_token->value);
+	if (!delim_info.cooked_delim)
+		return (0);
+	hd = create_hd(-1);
+	ret = -2;
+	if (hd)
+		ret = read_heredoc(prompt, delim_info, hd);
+	free(delim_info.cooked_delim);
+	if (ret != 0)
+		free(hd);
+	if (ret == -1)
+		return (-1);
+	if (ret == -2)
+		return (0);
+	addback_hd(&prompt->hd_lst, hd);
+	return (1);
 }
 
-//전역변수 exit_status 계산법이라는데 gpt한테 받은거라 아직 잘 모릅니다...
-//나중에 알게되면 알려드를게요
-//기본적으로 자식 프로세스 생성해서 입력을 받습니다.
-int	read_heredoc(t_prompt *prompt, t_delim_info delim_info)
+//이미 읽어 둔 heredoc 수 (여러 줄 명령은 줄을 이어 붙이기 전에 그 줄의 것을 먼저 읽음)
+static int	hd_count(t_hd *hd)
 {
-	int		fd[2];
-	pid_t	pid;
-	int		status;
+	int	count;
 
-	if (pipe(fd) < 0)
-		return (-2);
-	pid = fork();
-	if (pid < 0)
-		return (-2);
-	if (pid == 0)
+	count = 0;
+	while (hd)
 	{
-		close(fd[0]);
-		heredoc_child(delim_info.cooked_delim, fd[1], prompt->envp_lst);
+		count++;
+		hd = hd->next;
 	}
-	close(fd[1]);
-	waitpid(pid, &status, 0);
-	if (WIFEXITED(status))
-		g_exit_status = WEXITSTATUS(status);
-	else if (WIFSIGNALED(status))
-		g_exit_status = 128 + WTERMSIG(status);
-	if (g_exit_status != 0)
-		return (close(fd[0]), -1);
-	return (fd[0]);
+	return (count);
 }
 
-//herdoc value 처리해서 delim 만들어서 사용
-//자식프로세스 에서 fd 1에 입력후 fd 0반환
+//memfd에 입력후 되감은 fd를 줄에 나온 순서대로 저장 (명령은 같은 순서로 꺼내 씀)
+//앞에서 이미 읽은 heredoc은 건너뜀
 int	heredoc_process(t_prompt *prompt)
 {
-	t_token			*curr;
-	t_delim_info	delim_info;
-	int				fd;
+	t_token	*curr;
+	int		ret;
+	int		done;
 
 	curr = prompt->token_lst;
+	done = hd_count(prompt->hd_lst);
 	while (curr && curr->type != T_ERROR)
 	{
-		if (curr->type == T_HEREDOC && curr->next && curr->next->type == T_WORD)
+		if (curr->type == T_HEREDOC && curr->next && curr->next->type == T_WORD
+			&& done-- <= 0)
 		{
-			delim_info = make_delim(curr->next->value);
-			if (!delim_info.cooked_delim)
-				return (0);
-			fd = read_heredoc(prompt, delim_info);
-			free(delim_info.cooked_delim);
-			if (fd == -1)
+			ret = collect_heredoc(prompt, curr->next);
+			if (ret == -1)
 				return (clear_token_list(&prompt->token_lst), 1);
-			if (fd == -2 || !add_new_hd(&prompt->hd_lst, fd))
+			if (ret == 0)
 				return (0);
 		}
 		curr = curr->next;
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herdoc_read.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 16:52:31 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 16:52:31 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "herdoc.h"
+#include "global.h"
+#include "libft.h"
+#include "sigft.h"
+#include "script.h"
+#include <stdio.h>
+#include <readline/readline.h>
+#define DELIM_PRINT "minishell: warning: here-document \
+delimited by end-of-file (wanted `%s')\n"
+
+//heredoc 입력 중 SIGINT가 오면 readline을 바로 끝내도록 함
+static int	heredoc_event_hook(void)
+{
+	if (g_signal_received == SIGINT)
+		rl_done = 1;
+	return (0);
+}
+
+//읽은 줄을 그대로 src에 모으고 '$' 포함 여부만 기록
+static int	append_source_line(t_hd_ctx *ctx, char *line)
+{
+	if (ft_strchr(line, '$'))
+		ctx->has_dollar = 1;
+	if (!sbuf_append(&ctx->src, line, ft_strlen(line)))
+		return (0);
+	return (sbuf_addc(&ctx->src, '\n'));
+}
+
+//스크립트 모드면 readline 대신 스크립트의 다음 줄 (복사본이라 똑같이 free)
+static char	*next_body_line(t_hd_ctx *ctx)
+{
+	char	*line;
+
+	if (!ctx->shell->script)
+		return (readline("> "));
+	line = script_raw_line(ctx->shell->script);
+	if (!line)
+		return (NULL);
+	return (ft_strdup(line));
+}
+
+//구분자나 EOF를 만나면 0, SIGINT로 중단되면 1, malloc 실패시 -1
+static int	heredoc_loop(t_hd_ctx *ctx)
+{
+	char	*line;
+	int		ret;
+
+	while (1)
+	{
+		line = next_body_line(ctx);
+		if (g_signal_received == SIGINT)
+			return (free(line), 1);
+		if (!line && printf(DELIM_PRINT, ctx->info.cooked_delim))
+			return (0);
+		if (ft_strcmp(line, ctx->info.cooked_delim) == 0)
+			return (free(line), 0);
+		ret = append_source_line(ctx, line);
+		free(line);
+		if (!ret)
+			return (-1);
+	}
+}
+
+//SIGINT는 heredoc 전용 핸들러 + readline event hook으로 처리
+int	read_heredoc_body(t_hd_ctx *ctx)
+{
+	int	ret;
+
+	g_signal_received = 0;
+	setup_signals_heredoc();
+	rl_event_hook = heredoc_event_hook;
+	ret = heredoc_loop(ctx);
+	rl_event_hook = NULL;
+	setup_signals_interactive();
+	if (ret == 1)
+		g_signal_received = 0;
+	return (ret);
+}
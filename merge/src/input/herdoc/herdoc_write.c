@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herdoc_write.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:31:05 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 11:31:05 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "herdoc.h"
+#include "expand.h"
+#include "libft.h"
+
+//줄 단위로 버퍼에 모으고 HD_FLUSH_SIZE를 넘을 때만 write
+static int	heredoc_put(t_hd_ctx *ctx, char *line)
+{
+	if (!sbuf_append(&ctx->out, line, ft_strlen(line)))
+		return (0);
+	if (!sbuf_addc(&ctx->out, '\n'))
+		return (0);
+	if (ctx->out.len >= HD_FLUSH_SIZE)
+		return (sbuf_flush(&ctx->out, ctx->fd));
+	return (1);
+}
+
+//quoted 구분자면 그대로 쓰고, 아니면 '$'가 있는 줄만 확장
+static int	heredoc_write_line(t_hd_ctx *ctx, char *line)
+{
+	char	*expanded;
+	int		ret;
+
+	if (ctx->info.quoted_flag || !ft_strchr(line, '$'))
+		return (heredoc_put(ctx, line));
+	expanded = expand_process(line, ctx->envp);
+	if (!expanded)
+		return (0);
+	ret = heredoc_put(ctx, expanded);
+	free(expanded);
+	return (ret);
+}
+
+//모아둔 본문(src)을 줄 단위로 확장해서 ctx->fd에 씀
+int	heredoc_write_body(t_hd_ctx *ctx)
+{
+	char	*line;
+	char	*nl;
+	int		ret;
+
+	if (!sbuf_init(&ctx->out, HD_FLUSH_SIZE))
+		return (0);
+	line = ctx->src.data;
+	nl = ft_strchr(line, '\n');
+	while (nl)
+	{
+		*nl = '\0';
+		ret = heredoc_write_line(ctx, line);
+		*nl = '\n';
+		if (!ret)
+			return (sbuf_free(&ctx->out), 0);
+		line = nl + 1;
+		nl = ft_strchr(line, '\n');
+	}
+	ret = sbuf_flush(&ctx->out, ctx->fd);
+	sbuf_free(&ctx->out);
+	return (ret);
+}
+
+//원문만 있는 본문을 지금의 변수 값으로 새 memfd에 쓰고 이전 실행의 fd와 바꿈
+static int	expand_heredoc(t_hd *hd, t_shell *shell)
+{
+	t_hd_ctx	ctx;
+
+	ft_memset(&ctx, 0, sizeof(t_hd_ctx));
+	ctx.envp = shell->envp_list;
+	ctx.shell = shell;
+	ctx.src.data = hd->raw;
+	ctx.fd = open_heredoc_fd();
+	if (ctx.fd < 0)
+		return (0);
+	if (!heredoc_write_body(&ctx) || rewind_heredoc_fd(ctx.fd) < 0)
+		return (close(ctx.fd), 0);
+	if (hd->fd >= 0)
+		close(hd->fd);
+	hd->fd = ctx.fd;
+	return (1);
+}
+
+//명령 하나의 토큰(words)에 나오는 heredoc마다 hd를 하나씩 꺼내고
+//원문만 있는 본문은 실행하기 직전에 다시 확장 (반복마다 값이 바뀜)
+int	expand_heredocs(t_hd *hd, t_token *words, t_shell *shell)
+{
+	while (words && hd)
+	{
+		if (words->type == T_HEREDOC)
+		{
+			if (hd->raw && !expand_heredoc(hd, shell))
+				return (0);
+			hd = hd->next;
+		}
+		words = words->next;
+	}
+	return (1);
+}
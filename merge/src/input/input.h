@@ -15,7 +15,15 @@
 # include "types.h"
 
 void				syntax_print(t_grammar_status status, t_token **token_lst);
+int					expansion_abort(t_prompt *prompt);
 t_grammar_status	grammar_check(t_prompt *prompt);
 int					input_process(t_prompt *prompt);
+int					line_process(t_prompt *prompt, int use_cache);
+int					expand_and_split(t_prompt *prompt);
+t_grammar_status	parse_compound(t_prompt *prompt, t_grammar_status status,
+						int more);
+int					cached_input(t_prompt *prompt);
+void				remember_input(t_prompt *prompt);
+void				remember_pipeline(t_prompt *prompt, t_pipeline *pl);
 
 #endif
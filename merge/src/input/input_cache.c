@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_cache.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 15:31:08 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 15:31:08 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "input.h"
+#include "list.h"
+#include "libft.h"
+#include "parser.h"
+#include "print.h"
+
+//pathname expansion 대상이 될 수 있는 글자가 있는지
+static int	has_glob_char(const char *s)
+{
+	while (s && *s)
+	{
+		if (*s == '*' || *s == '?' || *s == '[')
+			return (1);
+		s++;
+	}
+	return (0);
+}
+
+//단어 하나가 얼마나 자주 다시 확장되어야 하는지 (scan_vars 참고)
+static int	word_level(const char *s)
+{
+	int		level;
+	char	*dollar;
+
+	if (has_glob_char(s) || ft_strnstr(s, "<(", ft_strlen(s))
+		|| ft_strnstr(s, ">(", ft_strlen(s)))
+		return (2);
+	level = (s[0] == '~');
+	dollar = ft_strchr(s, '$');
+	while (dollar && level < 2)
+	{
+		level = 1 + ((dollar[1] && ft_strchr(SPECIAL_PARAMS, dollar[1]))
+				|| !ft_strncmp(dollar, "${?", 3)
+				|| !ft_strncmp(dollar, "${#?", 4)
+				|| (dollar[1] == '(' && dollar[2] != '('));
+		dollar = ft_strchr(dollar + 1, '$');
+	}
+	return (level);
+}
+
+//변수 참조가 없으면 0, 환경변수(~ 포함)만 있으면 1, $?, $1, $( ), <( ), glob 문자가 있으면 2
+//$?, 위치 인자, 명령/프로세스 치환, 파일 목록은 매번 값이 바뀌므로 항상 다시 확장해야 함
+static int	scan_vars(t_token *token)
+{
+	int		has_var;
+	int		level;
+
+	has_var = 0;
+	while (token)
+	{
+		if (token->type == T_HEREDOC || token->type == T_HERESTRING)
+			return (-1);
+		if (token->type == T_WORD && token->value)
+		{
+			level = word_level(token->value);
+			if (level > has_var)
+				has_var = level;
+		}
+		token = token->next;
+	}
+	return (has_var);
+}
+
+//캐시된 줄이면 렉싱/문법검사를 건너뜀
+//변수가 없거나 환경이 그대로면 파싱된 파이프라인을 복사해서 1 반환
+//아니면 확장 전 토큰만 복사해서 2 반환 (확장부터 다시)
+//캐시에 없으면 0, 메모리 오류면 -1
+int	cached_input(t_prompt *prompt)
+{
+	t_shell			*shell;
+	t_line_cache	*entry;
+
+	shell = prompt->shell;
+	entry = find_line_cache(&shell->line_cache, prompt->input);
+	if (!entry)
+		return (shell->stats.line_cache_misses++, 0);
+	shell->stats.line_cache_hits++;
+	if (entry->pl && (entry->has_var == 0
+			|| (entry->has_var == 1 && entry->env_gen == shell->env_gen)))
+	{
+		prompt->pl = clone_pipeline(entry->pl);
+		if (!prompt->pl)
+			return (-1);
+		return (1);
+	}
+	shell->stats.line_cache_reexpand++;
+	prompt->token_lst = dup_token_list(entry->raw);
+	if (!prompt->token_lst)
+		return (-1);
+	print_tokens(prompt->token_lst, "cached");
+	prompt->line = entry;
+	return (2);
+}
+
+//문법 검사를 통과한 확장 전 토큰을 저장 (heredoc이 있는 줄은 제외)
+//저장에 실패해도 캐시만 안될뿐 진행에는 문제 없음
+void	remember_input(t_prompt *prompt)
+{
+	t_line_cache	*entry;
+	t_token			*raw;
+	char			*line;
+	int				has_var;
+
+	has_var = scan_vars(prompt->token_lst);
+	if (has_var < 0)
+		return ;
+	line = ft_strdup(prompt->input);
+	raw = dup_token_list(prompt->token_lst);
+	entry = NULL;
+	if (line && raw)
+		entry = create_line_cache(line, raw, has_var);
+	if (!entry)
+	{
+		free(line);
+		clear_token_list(&raw);
+		return ;
+	}
+	push_line_cache(&prompt->shell->line_cache, entry);
+	prompt->line = entry;
+}
+
+//확장까지 끝난 파이프라인을 어느 환경 기준인지와 함께 저장
+//ambiguous redirect가 난 줄은 에러 메세지를 다시 내야 하니 저장하지 않음
+void	remember_pipeline(t_prompt *prompt, t_pipeline *pl)
+{
+	t_line_cache	*entry;
+	int				i;
+
+	entry = prompt->line;
+	prompt->line = NULL;
+	if (!entry || entry->has_var == 2)
+		return ;
+	i = -1;
+	while (++i < pl->redir_count)
+		if (pl->redirs[i].flag)
+			return ;
+	free_pipeline(entry->pl);
+	entry->pl = clone_pipeline(pl);
+	entry->env_gen = prompt->shell->env_gen;
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_more.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:10:26 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 17:10:26 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <readline/readline.h>
+#include "input.h"
+#include "lexing.h"
+#include "script.h"
+#include "ast.h"
+#include "herdoc.h"
+
+//덜 끝난 명령 뒤에 다음 줄을 개행으로 이어 붙임
+//스크립트는 버퍼 안에서 바로 잇고, 터미널이면 "> " 프롬프트로 더 받음
+static int	read_more(t_prompt *prompt)
+{
+	char	*line;
+	char	*head;
+	char	*joined;
+
+	if (prompt->shell->script)
+		return (script_extend(prompt->shell->script));
+	line = readline("> ");
+	if (!line)
+		return (0);
+	head = ft_strjoin(prompt->input, "\n");
+	joined = NULL;
+	if (head)
+		joined = ft_strjoin(head, line);
+	free(head);
+	free(line);
+	if (!joined)
+		return (0);
+	free(prompt->input);
+	prompt->input = joined;
+	return (1);
+}
+
+//이어 붙인 입력 전체를 다시 렉싱하고 문법검사
+static t_grammar_status	relex(t_prompt *prompt)
+{
+	clear_token_list(&prompt->token_lst);
+	prompt->token_lst = input_lexing(prompt->input, 1);
+	if (!prompt->token_lst)
+		return (GRAMMAR_TOKEN_ERROR);
+	return (grammar_check(prompt));
+}
+
+//복합 명령 줄은 여기서 트리로 한 번만 파싱 (반복할 때는 확장만 다시 함)
+//줄 끝에서 덜 끝났으면 (fi 없는 if, 끝의 && 등) 다음 줄을 더 읽어서 다시
+//다음 줄보다 이 줄의 heredoc 본문이 먼저 오므로 그것부터 읽어 둠
+//명령 치환 안(more 0)은 더 읽을 곳이 없으므로 그대로 문법 오류
+//빈 줄들뿐이면 토큰을 지워서 아무것도 실행하지 않음
+t_grammar_status	parse_compound(t_prompt *prompt, t_grammar_status status,
+						int more)
+{
+	if (status == GRAMMAR_OK)
+		status = ast_parse(prompt);
+	while (status == GRAMMAR_EOF_ERROR && more && heredoc_process(prompt)
+		&& prompt->token_lst && read_more(prompt))
+	{
+		status = relex(prompt);
+		if (status == GRAMMAR_OK)
+			status = ast_parse(prompt);
+	}
+	if (status == GRAMMAR_OK && !prompt->ast)
+		clear_token_list(&prompt->token_lst);
+	return (status);
+}
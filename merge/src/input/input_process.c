@@ -18,7 +18,11 @@
 #include "expand.h"
 #include "split_word.h"
 #include "remove.h"
+#include "glob.h"
+#include "brace.h"
 #include "herdoc.h"
+#include "script.h"
+#include "ast.h"
 #include "print.h"
 
 //입력에 문자가 들어올때까지 계속 이 함수에서 입력받기
@@ -65,15 +69,31 @@ static int	handle_heredocs(t_prompt *prompt)
 	return (1);
 }
 
-static int	expand_and_split(t_prompt *prompt)
+//brace 확장은 따옴표와 $가 남아있을 때 먼저
+static int	brace_and_expand(t_prompt *prompt)
 {
-	if (!expand_token(prompt->token_lst, prompt->envp_lst))
+	if (!brace_expand(&prompt->token_lst))
 	{
-		perror("expand_token fail");
+		perror("brace_expand fail");
+		return (0);
+	}
+	print_tokens(prompt->token_lst, "brace");
+	if (!expand_token(prompt->token_lst, prompt->shell->envp_list))
+	{
+		if (!exp_error(0))
+			perror("expand_token fail");
 		return (0);
 	}
 	print_tokens(prompt->token_lst, "expand");
-	if (!split_words(&prompt->token_lst))
+	return (1);
+}
+
+//복합 명령의 트리도 명령 하나를 실행할 때마다 이걸로 확장
+int	expand_and_split(t_prompt *prompt)
+{
+	if (!brace_and_expand(prompt))
+		return (0);
+	if (!split_words(&prompt->token_lst, prompt->shell->envp_list))
 	{
 		perror("split_expanded_words fail");
 		return (0);
@@ -85,30 +105,81 @@ static int	expand_and_split(t_prompt *prompt)
 		return (0);
 	}
 	print_tokens(prompt->token_lst, "remove");
+	if (!glob_expand(prompt->token_lst))
+	{
+		perror("glob_expand fail");
+		return (0);
+	}
+	print_tokens(prompt->token_lst, "glob");
 	return (1);
 }
 
-//1. 입력받기
-//2. 렉싱하기
-//3. 문법검사
-//4. herdoc처리
-//5. GRAMMAR_OK일때 확장, 분리 및 quote제거
-int	input_process(t_prompt *prompt)
+//캐시에 없는 줄: 렉싱, 문법검사, herdoc처리 후 확장 전 토큰을 캐시에 저장
+//복합 명령 줄은 트리로 파싱해 두고 캐시에 넣지 않음
+static int	lex_and_check(t_prompt *prompt, t_grammar_status *status,
+				int use_cache)
 {
-	t_grammar_status	status;
-
-	if (!get_user_input(prompt))
-		return (0);
 	prompt->token_lst = lex_input(prompt);
 	if (!prompt->token_lst)
 		return (0);
-	status = grammar_check(prompt);
+	*status = grammar_check(prompt);
+	if (is_compound_line(prompt->token_lst))
+		*status = parse_compound(prompt, *status, use_cache);
 	print_tokens(prompt->token_lst, "check");
 	if (!handle_heredocs(prompt))
 		return (0);
-	syntax_print(status, &prompt->token_lst);
-	if (prompt->token_lst && status == GRAMMAR_OK)
+	syntax_print(*status, &prompt->token_lst);
+	if (!prompt->token_lst)
+		free_ast(prompt->ast);
+	if (!prompt->token_lst)
+		prompt->ast = NULL;
+	if (use_cache && prompt->token_lst && *status == GRAMMAR_OK
+		&& !prompt->ast)
+		remember_input(prompt);
+	return (1);
+}
+
+//prompt->input 한 줄을 실행 직전까지 처리
+//1. 캐시에 있는 줄이면 렉싱/문법검사 생략
+//2. 렉싱하기
+//3. 문법검사
+//4. herdoc처리
+//5. GRAMMAR_OK일때 확장, 분리 및 quote제거 (트리는 실행할 때 명령마다 확장)
+//확장 오류(bad substitution 등)가 난 줄은 실행하지 않고 $?만 1
+//명령 치환 안의 줄은 use_cache 0 (바깥 줄의 캐시 항목이 밀려나지 않게)
+//subst_status는 이 줄에서 마지막으로 끝난 $( )의 종료 상태 (명령 없는 줄의 $?)
+int	line_process(t_prompt *prompt, int use_cache)
+{
+	t_grammar_status	status;
+	int					cached;
+
+	prompt->shell->subst_status = 0;
+	cached = 0;
+	if (use_cache)
+		cached = cached_input(prompt);
+	if (cached == 1 || cached == -1)
+		return (cached == 1);
+	status = GRAMMAR_OK;
+	if (cached == 0 && !lex_and_check(prompt, &status, use_cache))
+		return (expansion_abort(prompt));
+	if (prompt->token_lst && status == GRAMMAR_OK && !prompt->ast)
 		if (!expand_and_split(prompt))
-			return (0);
+			return (expansion_abort(prompt));
 	return (1);
 }
+
+//스크립트 모드는 프롬프트/readline/history 없이 버퍼에서 다음 줄을 바로 꺼냄
+//이때 prompt->input은 버퍼 안을 가리키므로 free하면 안됨
+int	input_process(t_prompt *prompt)
+{
+	t_script	*sc;
+
+	sc = prompt->shell->script;
+	if (sc)
+		prompt->input = script_next_line(sc);
+	if (sc && !prompt->input)
+		return (0);
+	if (!sc && !get_user_input(prompt))
+		return (0);
+	return (line_process(prompt, 1));
+}
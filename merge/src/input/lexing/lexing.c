@@ -15,18 +15,32 @@
 
 static int	partiotion_token(t_token **token_lst, char *input)
 {
-	if (is_operator(*input))
+	if ((is_operator(*input) && !is_procsub(input)) || io_number_len(input)
+		|| is_and_op(input))
 		return (handle_operator(token_lst, input));
 	else
 		return (handle_word(token_lst, input));
 }
 
+//여러 줄로 이어진 입력의 개행은 ;처럼 명령을 나누는 토큰
+static int	add_newline(t_token **token_lst)
+{
+	char	*value;
+
+	value = ft_strdup("newline");
+	if (!value)
+		return (0);
+	return (add_new_token(token_lst, value, T_NEWLINE));
+}
+
 static int	lexing_loop(t_token **token_lst, char *input)
 {
 	int	len;
 
 	while (*input)
 	{
+		if (*input == '\n' && !add_newline(token_lst))
+			return (0);
 		if (is_space(*input))
 		{
 			input++;
@@ -17,7 +17,13 @@
 # include "list.h"
 
 int		handle_operator(t_token **token_lst, char *input);
+int		io_number_len(char *input);
+int		is_and_op(char *input);
 int		handle_word(t_token **token_lst, char *input);
+int		is_procsub(char *s);
+int		is_array_value(char *start, char *input);
+char	*skip_array_value(char *input);
+int		is_open_array(char *word);
 t_token	*input_lexing(char *input, int add_end_node);
 
 #endif
@@ -12,49 +12,100 @@
 
 #include "lexing.h"
 
+//;, ;;, &&, ||, (, ) 는 목록/복합 명령용
+static t_token_type	decide_list_type(char *input)
+{
+	if (*input == ';' && input[1] == ';')
+		return (T_DSEMI);
+	if (*input == ';')
+		return (T_SEMI);
+	if (*input == '&')
+		return (T_AND);
+	if (*input == '(')
+		return (T_LPAREN);
+	if (*input == ')')
+		return (T_RPAREN);
+	return (T_ERROR);
+}
+
 static t_token_type	decide_op_type(char *input)
 {
+	if (*input == '|' && input[1] == '|')
+		return (T_OR);
 	if (*input == '|')
 		return (T_PIPE);
 	if (*input == '<')
 	{
 		input++;
+		if (*input == '<' && input[1] == '<')
+			return (T_HERESTRING);
 		if (*input && *input == '<')
 			return (T_HEREDOC);
-		else
-			return (T_REDIR_IN);
+		if (*input == '&')
+			return (T_DUP_IN);
+		return (T_REDIR_IN);
 	}
 	if (*input == '>')
 	{
 		input++;
 		if (*input && *input == '>')
 			return (T_APPEND);
-		else
-			return (T_REDIR_OUT);
+		if (*input == '&')
+			return (T_DUP_OUT);
+		return (T_REDIR_OUT);
 	}
-	return (T_ERROR);
+	return (decide_list_type(input));
 }
 
 static int	get_op_length(t_token_type type)
 {
-	if (type == T_PIPE || type == T_REDIR_IN || type == T_REDIR_OUT)
+	if (type == T_PIPE || type == T_REDIR_IN || type == T_REDIR_OUT
+		|| type == T_SEMI || type == T_LPAREN || type == T_RPAREN)
 		return (1);
-	else if (type == T_HEREDOC || type == T_APPEND)
+	else if (type == T_HEREDOC || type == T_APPEND
+		|| type == T_DUP_IN || type == T_DUP_OUT
+		|| type == T_DSEMI || type == T_AND || type == T_OR)
 		return (2);
+	else if (type == T_HERESTRING)
+		return (3);
 	else
 		return (0);
 }
 
+//2>, 10<& 처럼 단어 맨 앞의 숫자 바로 뒤에 <, >가 오면 숫자까지 연산자
+//(값에 그대로 남겨두고 파서가 fd 번호로 읽음)
+int	io_number_len(char *input)
+{
+	int	n;
+
+	n = 0;
+	while (ft_isdigit(input[n]))
+		n++;
+	if (n == 0 || (input[n] != '<' && input[n] != '>')
+		|| is_procsub(input + n))
+		return (0);
+	return (n);
+}
+
+//&는 &&일 때만 연산자 (혼자 있는 &는 예전처럼 단어의 일부)
+int	is_and_op(char *input)
+{
+	return (input[0] == '&' && input[1] == '&');
+}
+
 int	handle_operator(t_token **token_lst, char *input)
 {
 	int				len;
+	int				io;
 	char			*value;
 	t_token_type	type;
 
-	type = decide_op_type(input);
+	io = io_number_len(input);
+	type = decide_op_type(input + io);
 	len = get_op_length(type);
 	if (len == 0)
 		return (-1);
+	len += io;
 	value = ft_my_strndup(input, len);
 	if (!value)
 		return (-1);
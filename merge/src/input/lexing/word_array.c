@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   word_array.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 18:20:44 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 18:20:44 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "lexing.h"
+#include "expand.h"
+
+//name=( ... ) 배열 대입의 '=(' 인지 (단어가 여기까지 이름 글자뿐이어야 함)
+//맞으면 괄호 안의 공백과 개행도 닫는 ')'까지 한 단어 (skip_array_value)
+int	is_array_value(char *start, char *input)
+{
+	char	*p;
+
+	if (input == start || input[0] != '=' || input[1] != '(')
+		return (0);
+	if (!ft_isalpha(*start) && *start != '_')
+		return (0);
+	p = start + 1;
+	while (p < input && (ft_isalnum(*p) || *p == '_'))
+		p++;
+	return (p == input);
+}
+
+//'=(' 뒤의 짝이 맞는 ')' 다음, 안닫혔으면 입력 끝까지 한 단어
+//(문법 검사가 그 단어를 보고 다음 줄을 더 읽게 함)
+char	*skip_array_value(char *input)
+{
+	size_t	end;
+
+	end = find_paren_end(input, 2);
+	if (end == 0)
+		return (input + ft_strlen(input));
+	return (input + end + 1);
+}
+
+//입력 끝까지 삼킨, 닫히지 않은 name=( 단어인지
+int	is_open_array(char *word)
+{
+	char	*eq;
+
+	eq = ft_strchr(word, '=');
+	return (eq && is_array_value(word, eq) && find_paren_end(eq, 2) == 0);
+}
@@ -13,6 +13,9 @@
 #include "lexing.h"
 #include "utils.h"
 
+static char	*skip_dollar_group(char *s);
+
+//큰따옴표 안의 $( ), ${ }는 안에 따옴표가 또 있어도 통째로 넘김
 static char	*skip_quotes(char *s)
 {
 	char	qc;
@@ -20,23 +23,73 @@ static char	*skip_quotes(char *s)
 	qc = *s;
 	s++;
 	while (*s && *s != qc)
-		s++;
+	{
+		if (qc == '"' && *s == '$' && (s[1] == '(' || s[1] == '{'))
+			s = skip_dollar_group(s);
+		else
+			s++;
+	}
 	if (*s == qc)
 		return (++s);
 	return (s);
 }
 
+//$( ... ), $(( ... )), ${ ... }, <( ... ) 는 안에 공백이나 연산자가 있어도 한 단어
+//닫히지 않았으면 '$'만 넘김
+static char	*skip_dollar_group(char *s)
+{
+	char	open;
+	char	close;
+	int		depth;
+	char	*p;
+
+	open = s[1];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = 0;
+	p = s + 1;
+	while (*p)
+	{
+		if (*p == '\'' || *p == '"')
+		{
+			p = skip_quotes(p);
+			continue ;
+		}
+		depth += (*p == open) - (*p == close);
+		if (*p++ == close && depth == 0)
+			return (p);
+	}
+	return (s + 1);
+}
+
+//<( ... ), >( ... ) 가 닫혀 있으면 연산자가 아니라 단어의 일부
+int	is_procsub(char *s)
+{
+	if ((s[0] != '<' && s[0] != '>') || s[1] != '(')
+		return (0);
+	return (skip_dollar_group(s) != s + 1);
+}
+
 static int	get_word_length(char *input)
 {
 	char	*start;
+	char	*next;
 
 	start = input;
-	while (*input && !is_space(*input) && !is_operator(*input))
+	while (*input && !is_space(*input))
 	{
+		next = input + 1;
 		if (*input == '\'' || *input == '"')
-			input = skip_quotes(input);
-		else
-			input++;
+			next = skip_quotes(input);
+		else if ((*input == '$' && (input[1] == '(' || input[1] == '{'))
+			|| is_procsub(input))
+			next = skip_dollar_group(input);
+		else if (is_array_value(start, input))
+			next = skip_array_value(input);
+		else if (is_operator(*input) || is_and_op(input))
+			break ;
+		input = next;
 	}
 	return (input - start);
 }
@@ -13,47 +13,80 @@
 #include "libft.h"
 #include "utils.h"
 #include "list.h"
-#include "lexing.h"
+#include "state.h"
 #include <stdio.h>
 
-static char	*remove_quotes_from_str(const char *s)
+//따옴표와 *, ?, [ 가 같이 있는 단어는 확장이 없었어도 mask를 만들어 둠
+//(globbing에서 따옴표 안에 있던 글자를 구분해야 함)
+static int	ensure_mask(t_token *tok)
 {
-	char	*result;
 	size_t	i;
+	int		quote;
+	int		meta;
 
-	result = ft_strdup("");
-	if (!result)
-		return (NULL);
+	if (tok->mask)
+		return (1);
+	quote = 0;
+	meta = 0;
 	i = 0;
-	while (s[i])
+	while (tok->value[i])
 	{
-		if (s[i] != '\'' && s[i] != '"')
+		quote |= is_quote(tok->value[i]);
+		meta |= (tok->value[i] == '*' || tok->value[i] == '?'
+				|| tok->value[i] == '[');
+		i++;
+	}
+	if (!quote || !meta)
+		return (1);
+	tok->mask = ft_calloc(i + 1, 1);
+	return (tok->mask != NULL);
+}
+
+//소스에 있던 따옴표(MASK_LITERAL) 중 상태를 바꾸는 것만 제거
+//다른 따옴표 안의 따옴표나 확장으로 생긴 따옴표는 글자 그대로 남김
+//새로 할당하지 않고 그 자리에서 앞으로 당김 (mask도 같이)
+//따옴표 안에 있던 글자는 MASK_QUOTED로 바꿔서 globbing 대상에서 빠지게 함
+//원소 없는 "$@" 자리의 MASK_VANISH 글자도 여기서 빠짐
+static void	remove_quotes_in_place(t_token *tok)
+{
+	t_quote_state	state;
+	t_quote_state	next;
+	size_t			i;
+	size_t			j;
+
+	state = STATE_GENERAL;
+	i = 0;
+	j = 0;
+	while (tok->value[i])
+	{
+		next = state;
+		if (!tok->mask || tok->mask[i] == MASK_LITERAL)
+			next = state_machine(tok->value[i], state);
+		if (next == state && (!tok->mask || tok->mask[i] != MASK_VANISH))
 		{
-			result = charjoin_and_free(result, s[i]);
-			if (!result)
-				return (NULL);
+			if (tok->mask)
+				tok->mask[j] = tok->mask[i];
+			if (tok->mask && state != STATE_GENERAL)
+				tok->mask[j] = MASK_QUOTED;
+			tok->value[j++] = tok->value[i];
 		}
+		state = next;
 		i++;
 	}
-	return (result);
+	tok->value[j] = '\0';
 }
 
 int	remove_quotes_from_tokens(t_token *token_lst)
 {
 	t_token	*curr;
-	char	*new_value;
 
 	curr = token_lst;
 	while (curr && curr->type != T_END)
 	{
-		new_value = remove_quotes_from_str(curr->value);
-		if (!new_value)
+		if (curr->value && !ensure_mask(curr))
 			return (0);
-		if (new_value)
-		{
-			free(curr->value);
-			curr->value = new_value;
-		}
+		if (curr->value)
+			remove_quotes_in_place(curr);
 		curr = curr->next;
 	}
 	return (1);
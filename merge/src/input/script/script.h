@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 10:31:05 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 10:31:05 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SCRIPT_H
+# define SCRIPT_H
+# include "types.h"
+# include "utils.h"
+# define SCRIPT_READ_SIZE 65536
+
+//script_open.c
+int		script_from_fd(t_script *sc, int fd);
+int		script_open(t_script *sc, const char *path);
+void	script_close(t_script *sc);
+
+//script_buf.c
+int		script_from_string(t_script *sc, const char *s);
+int		script_from_buffer(t_script *sc, const char *data, size_t len);
+
+//script_line.c
+char	*script_next_line(t_script *sc);
+int		script_extend(t_script *sc);
+char	*script_raw_line(t_script *sc);
+
+//script_end.c
+int		script_at_end(t_script *sc);
+
+#endif
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_buf.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 18:30:44 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 18:30:44 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "script.h"
+#include "libft.h"
+
+int	script_from_string(t_script *sc, const char *s)
+{
+	return (script_from_buffer(sc, s, ft_strlen(s)));
+}
+
+//실행하면서 줄 끝에 '\0'을 쓰므로 원본은 두고 복사해서 씀
+//(source 캐시의 원본을 여러 번 다시 실행할 수 있게)
+int	script_from_buffer(t_script *sc, const char *data, size_t len)
+{
+	ft_memset(sc, 0, sizeof(t_script));
+	sc->data = malloc(len + 1);
+	if (!sc->data)
+		return (0);
+	ft_memcpy(sc->data, data, len);
+	sc->data[len] = '\0';
+	sc->len = len;
+	return (1);
+}
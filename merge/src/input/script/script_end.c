@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_end.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 14:20:11 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 14:20:11 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "script.h"
+
+//남은 입력이 공백, 빈 줄, 주석뿐이면 1 (pos는 그대로)
+//마지막 명령인지 미리 알아야 fork 없이 exec할 수 있음
+int	script_at_end(t_script *sc)
+{
+	size_t	i;
+
+	i = sc->pos;
+	while (i < sc->len)
+	{
+		if (sc->data[i] == '#')
+		{
+			while (i + 1 < sc->len && sc->data[i + 1] != '\n')
+				i++;
+		}
+		else if (!is_space(sc->data[i]))
+			return (0);
+		i++;
+	}
+	return (1);
+}
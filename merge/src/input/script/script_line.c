@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_line.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 10:48:19 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 10:48:19 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "script.h"
+#include "libft.h"
+
+//따옴표 밖에서 단어가 시작되는 자리의 #부터 줄 끝까지는 주석
+static int	comment_start(t_script *sc, size_t i)
+{
+	if (sc->data[i] != '#')
+		return (0);
+	if (i == sc->pos)
+		return (1);
+	return (sc->data[i - 1] && ft_strchr(" \t;&|<>()", sc->data[i - 1]));
+}
+
+//따옴표 밖의 개행이나 주석 시작 위치 (따옴표 안의 개행은 줄에 포함)
+static size_t	line_end(t_script *sc)
+{
+	size_t	i;
+	char	quote;
+
+	i = sc->pos;
+	quote = 0;
+	while (i < sc->len)
+	{
+		if (quote && sc->data[i] == quote)
+			quote = 0;
+		else if (!quote && (sc->data[i] == '\'' || sc->data[i] == '"'))
+			quote = sc->data[i];
+		else if (!quote && (sc->data[i] == '\n' || comment_start(sc, i)))
+			return (i);
+		i++;
+	}
+	return (i);
+}
+
+//다음 명령 줄을 버퍼 안에서 그대로 잘라서 돌려줌 (복사 없음, free하면 안됨)
+//끝 자리에 '\0'을 쓰고 다음 줄로 넘어감, 빈 줄과 주석만 있는 줄은 건너뜀
+//더 없으면 NULL
+char	*script_next_line(t_script *sc)
+{
+	char	*line;
+	size_t	end;
+
+	while (sc->pos < sc->len)
+	{
+		line = sc->data + sc->pos;
+		end = line_end(sc);
+		sc->pos = end;
+		while (sc->pos < sc->len && sc->data[sc->pos] != '\n')
+			sc->pos++;
+		if (sc->pos < sc->len)
+			sc->pos++;
+		if (end < sc->len)
+			sc->data[end] = '\0';
+		sc->cut = end;
+		if (*line)
+			return (line);
+	}
+	return (NULL);
+}
+
+//여러 줄 명령: 지금 줄 바로 뒤에 다음 줄을 개행째 이어 붙임 (줄 시작 주소는 그대로)
+//잘라둔 '\0'과 주석은 공백으로 덮음, 더 없으면 0
+int	script_extend(t_script *sc)
+{
+	size_t	end;
+
+	if (sc->pos >= sc->len || sc->cut >= sc->pos)
+		return (0);
+	ft_memset(sc->data + sc->cut, ' ', sc->pos - 1 - sc->cut);
+	sc->data[sc->pos - 1] = '\n';
+	end = line_end(sc);
+	sc->pos = end;
+	while (sc->pos < sc->len && sc->data[sc->pos] != '\n')
+		sc->pos++;
+	if (sc->pos < sc->len)
+		sc->pos++;
+	if (end < sc->len)
+		sc->data[end] = '\0';
+	sc->cut = end;
+	return (1);
+}
+
+//heredoc 본문용: 따옴표나 주석 상관없이 개행까지 그대로
+char	*script_raw_line(t_script *sc)
+{
+	char	*line;
+
+	if (sc->pos >= sc->len)
+		return (NULL);
+	line = sc->data + sc->pos;
+	while (sc->pos < sc->len && sc->data[sc->pos] != '\n')
+		sc->pos++;
+	if (sc->pos < sc->len)
+		sc->data[sc->pos++] = '\0';
+	return (line);
+}
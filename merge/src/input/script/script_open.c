@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_open.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 10:34:52 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 10:34:52 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "script.h"
+#include "libft.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//일반 파일은 통째로 mmap (MAP_PRIVATE라 줄 끝에 '\0'을 써도 파일은 그대로)
+//크기가 페이지 배수면 마지막 '\0' 자리가 없어서 read로 넘김
+static int	script_map(t_script *sc, int fd, size_t size)
+{
+	void	*data;
+
+	if (size % (size_t)sysconf(_SC_PAGESIZE) == 0)
+		return (0);
+	data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+		return (0);
+	sc->data = data;
+	sc->len = size;
+	sc->mapped = 1;
+	return (1);
+}
+
+//파이프처럼 크기를 모르면 큰 버퍼로 EOF까지 한번에 읽음
+static int	script_read(t_script *sc, int fd, size_t hint)
+{
+	t_sbuf	sb;
+
+	if (!sbuf_init(&sb, hint + 1))
+		return (0);
+	if (!read_all(fd, &sb))
+	{
+		free(sb.data);
+		return (0);
+	}
+	sc->data = sb.data;
+	sc->len = sb.len;
+	return (1);
+}
+
+//fd를 끝까지 버퍼에 올림, 명령들이 같은 stdin을 읽으면 EOF가 보이도록 끝으로 옮겨둠
+int	script_from_fd(t_script *sc, int fd)
+{
+	struct stat	st;
+	int			ret;
+
+	ft_memset(sc, 0, sizeof(t_script));
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+		return (script_read(sc, fd, SCRIPT_READ_SIZE));
+	if (st.st_size == 0)
+		return (script_from_string(sc, ""));
+	ret = script_map(sc, fd, st.st_size);
+	if (ret)
+		lseek(fd, 0, SEEK_END);
+	else
+		ret = script_read(sc, fd, st.st_size);
+	return (ret);
+}
+
+int	script_open(t_script *sc, const char *path)
+{
+	int	fd;
+	int	ret;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	ret = script_from_fd(sc, fd);
+	close(fd);
+	return (ret);
+}
+
+void	script_close(t_script *sc)
+{
+	if (sc->mapped)
+		munmap(sc->data, sc->len);
+	else
+		free(sc->data);
+	ft_memset(sc, 0, sizeof(t_script));
+}
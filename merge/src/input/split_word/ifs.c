@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ifs.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 18:12:40 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 18:12:40 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "split_word.h"
+#include "libft.h"
+
+//IFS가 unset이면 기본값 " \t\n"
+const char	*get_ifs(t_envp *envp_lst)
+{
+	while (envp_lst)
+	{
+		if (ft_strcmp(envp_lst->key, "IFS") == 0)
+			return (envp_lst->value);
+		envp_lst = envp_lst->next;
+	}
+	return (" \t\n");
+}
+
+static int	is_ifs_space(char c)
+{
+	return (c == ' ' || c == '\t' || c == '\n');
+}
+
+//따옴표 밖에서 확장된 글자(MASK_UNQUOTED)만 구분자가 될 수 있음
+//"$@" 원소 사이의 MASK_BREAK는 IFS와 상관없이 항상 구분자 (공백처럼 겹침)
+int	is_ifs_delim(t_token *tok, size_t i, const char *ifs)
+{
+	char	c;
+
+	c = tok->value[i];
+	if (tok->mask && tok->mask[i] == MASK_BREAK && c)
+		return (1);
+	if (!tok->mask || tok->mask[i] != MASK_UNQUOTED || c == '\0')
+		return (0);
+	return (ft_strchr(ifs, c) != NULL);
+}
+
+//앞쪽 IFS 공백은 버림
+//IFS 공백 연속은 구분자 하나, 공백이 아닌 IFS 글자는 각각 구분자 하나
+//(앞뒤 공백은 같은 구분자에 포함) 끝에 남은 구분자는 빈 필드를 만들지 않음
+int	next_field(t_token *tok, const char *ifs, t_field *f)
+{
+	int	space;
+
+	if (f->pos == 0)
+		while (is_ifs_delim(tok, f->pos, ifs)
+			&& is_ifs_space(tok->value[f->pos]))
+			f->pos++;
+	if (!tok->value[f->pos])
+		return (0);
+	f->start = f->pos;
+	while (tok->value[f->pos] && !is_ifs_delim(tok, f->pos, ifs))
+		f->pos++;
+	f->end = f->pos;
+	if (!tok->value[f->pos])
+		return (1);
+	space = is_ifs_space(tok->value[f->pos++]);
+	while (is_ifs_delim(tok, f->pos, ifs) && is_ifs_space(tok->value[f->pos]))
+		f->pos++;
+	if (space && is_ifs_delim(tok, f->pos, ifs))
+	{
+		f->pos++;
+		while (is_ifs_delim(tok, f->pos, ifs)
+			&& is_ifs_space(tok->value[f->pos]))
+			f->pos++;
+	}
+	return (1);
+}
+
+int	count_fields(t_token *tok, const char *ifs)
+{
+	t_field	f;
+	int		count;
+
+	f.pos = 0;
+	count = 0;
+	while (next_field(tok, ifs, &f))
+		count++;
+	return (count);
+}
@@ -12,7 +12,23 @@
 
 #ifndef SPLIT_WORD_H
 # define SPLIT_WORD_H
+# include "types.h"
+# include <stddef.h>
 
-int	split_words(t_token **token_lst);
+typedef struct s_field
+{
+	size_t	pos;
+	size_t	start;
+	size_t	end;
+}	t_field;
+
+//ifs.c
+const char	*get_ifs(t_envp *envp_lst);
+int			is_ifs_delim(t_token *tok, size_t i, const char *ifs);
+int			next_field(t_token *tok, const char *ifs, t_field *f);
+int			count_fields(t_token *tok, const char *ifs);
+
+//split_words.c
+int			split_words(t_token **token_lst, t_envp *envp_lst);
 
 #endif
@@ -11,80 +11,119 @@
 /* ************************************************************************** */
 
 #include "types.h"
-#include "lexing.h"
+#include "split_word.h"
 #include "list.h"
 #include "libft.h"
 #include "utils.h"
 
-static int	only_space(char *value)
+//확장으로 생긴 IFS 글자가 없으면 손대지 않음 (확장 안된 단어는 mask가 NULL)
+//따옴표 없이 빈 값으로 확장된 단어는 필드가 없으니 지워야 함
+//원소 없는 "$@"의 MASK_VANISH도 지울지 봐야 함
+static int	needs_split(t_token *tok, const char *ifs)
 {
-	if (!value)
+	size_t	i;
+
+	if (!tok->mask)
+		return (0);
+	if (tok->value[0] == '\0')
 		return (1);
-	while (*value)
+	i = 0;
+	while (tok->value[i])
 	{
-		if (!is_space(*value))
-			return (0);
-		value++;
+		if (is_ifs_delim(tok, i, ifs) || tok->mask[i] == MASK_VANISH)
+			return (1);
+		i++;
 	}
-	return (1);
+	return (0);
 }
 
-static int	process_word_token(t_token *curr, t_token **new_lst)
+//필드가 MASK_VANISH와 소스의 따옴표뿐이면 ("$@" 하나뿐인데 인자가 없음) 단어가 없음
+static int	field_vanishes(t_token *tok, t_field *f)
 {
-	t_token	*lexed;
-	t_token	*tmp;
+	size_t	i;
+	int		vanish;
 
-	if (only_space(curr->value))
-		return (1);
-	lexed = input_lexing(curr->value, 0);
-	if (!lexed)
-		return (0);
-	tmp = lexed;
-	while (tmp)
+	vanish = 0;
+	i = f->start;
+	while (i < f->end)
 	{
-		if (!add_new_token(new_lst, ft_strdup(tmp->value), tmp->type))
-		{
-			clear_token_list(&lexed);
-			clear_token_list(new_lst);
+		if (tok->mask[i] == MASK_VANISH)
+			vanish = 1;
+		else if (tok->mask[i] != MASK_LITERAL
+			|| (tok->value[i] != '"' && tok->value[i] != '\''))
 			return (0);
-		}
-		tmp = tmp->next;
+		i++;
 	}
-	clear_token_list(&lexed);
-	return (1);
+	return (vanish);
 }
 
-static int	process_other_token(t_token *curr, t_token **new_lst)
+//필드 하나를 값과 mask까지 함께 잘라서 새 WORD 토큰으로
+static t_token	*field_token(t_token *tok, t_field *f)
 {
-	if (!add_new_token(new_lst, ft_strdup(curr->value), curr->type))
-		return (0);
-	return (1);
+	t_token	*new_token;
+	size_t	len;
+
+	len = f->end - f->start;
+	new_token = create_token(ft_my_strndup(tok->value + f->start, len),
+			T_WORD);
+	if (!new_token)
+		return (NULL);
+	new_token->mask = malloc(len + 1);
+	if (!new_token->value || !new_token->mask)
+		return (clear_token_list(&new_token), NULL);
+	ft_memcpy(new_token->mask, tok->mask + f->start, len);
+	new_token->mask[len] = MASK_LITERAL;
+	return (new_token);
 }
 
-int	split_words(t_token **token_lst)
+//필드들을 원래 토큰 자리에 순서대로 끼워넣고 원래 토큰은 버림
+//다음에 볼 토큰을 가리키는 link 반환, 실패시 NULL
+static t_token	**split_token(t_token **link, const char *ifs)
 {
-	t_token	*curr;
-	t_token	*new_lst;
+	t_token	*tok;
+	t_token	*new_token;
+	t_field	f;
+
+	tok = *link;
+	f.pos = 0;
+	while (next_field(tok, ifs, &f))
+	{
+		if (field_vanishes(tok, &f))
+			continue ;
+		new_token = field_token(tok, &f);
+		if (!new_token)
+			return (NULL);
+		new_token->next = tok;
+		*link = new_token;
+		link = &new_token->next;
+	}
+	*link = tok->next;
+	tok->next = NULL;
+	clear_token_list(&tok);
+	return (link);
+}
+
+//다시 렉싱하지 않고 확장 출처(mask)를 보고 그 자리에서 나눔
+//나뉜 조각은 항상 WORD라서 변수 안의 '|', '>'가 연산자가 되지 않음
+int	split_words(t_token **token_lst, t_envp *envp_lst)
+{
+	t_token		**link;
+	const char	*ifs;
 
 	if (!token_lst)
 		return (0);
-	curr = *token_lst;
-	new_lst = NULL;
-	while (curr && curr->type != T_END)
+	ifs = get_ifs(envp_lst);
+	link = token_lst;
+	while (*link && (*link)->type != T_END)
 	{
-		if (curr->type == T_WORD)
+		if ((*link)->type == T_WORD && needs_split(*link, ifs))
 		{
-			if (!process_word_token(curr, &new_lst))
+			link = split_token(link, ifs);
+			if (!link)
 				return (0);
 		}
 		else
-		{
-			if (!process_other_token(curr, &new_lst))
-				return (0);
-		}
-		curr = curr->next;
+			link = &(*link)->next;
 	}
-	if (!add_new_token(&new_lst, ft_strdup("newline"), T_END))
-		return (0);
-	return (clear_token_list(token_lst), *token_lst = new_lst, 1);
+	return (1);
 }
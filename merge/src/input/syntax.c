@@ -14,6 +14,8 @@
 #include "global.h"
 #include "libft.h"
 #include "list.h"
+#include "expand.h"
+#include "ast.h"
 
 static void	handle_error(t_grammar_status status, t_token *token_lst)
 {
@@ -42,6 +44,18 @@ static void	handle_error(t_grammar_status status, t_token *token_lst)
 	}
 }
 
+//확장 오류로 멈춘 줄은 syntax 오류처럼 토큰을 버리고 $?=1, 그 외의 실패는 0
+int	expansion_abort(t_prompt *prompt)
+{
+	if (!exp_error(-1))
+		return (0);
+	g_exit_status = 1;
+	clear_token_list(&prompt->token_lst);
+	free_ast(prompt->ast);
+	prompt->ast = NULL;
+	return (1);
+}
+
 void	syntax_print(t_grammar_status status, t_token **token_lst)
 {
 	if (!*token_lst)
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:12:40 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 10:12:40 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AST_H
+# define AST_H
+# include "types.h"
+# include "libft.h"
+# include "utils.h"
+# include <stdio.h>
+# define AST_ERR_TOKEN 1
+# define AST_ERR_EOF 2
+# define AST_ERR_MEM 3
+# define FUNC_BUCKETS 64
+# define ARRAY_INDEXED 1
+# define ARRAY_ASSOC 2
+
+//파싱 중인 위치, 지금까지 지나간 heredoc 수, 오류 종류
+typedef struct s_astp
+{
+	t_token	*cur;
+	int		hd;
+	int		err;
+}	t_astp;
+
+//트리를 실행하는 동안 필요한 것 (heredoc fd는 줄 전체의 목록에서 꺼냄)
+typedef struct s_run
+{
+	t_shell	*shell;
+	t_hd	*hd;
+}	t_run;
+
+//ast_word.c
+int					is_assignment(const char *s);
+int					assign_count(t_token *tok);
+int					is_reserved(t_token *tok);
+int					is_compound_start(t_token *tok);
+int					is_compound_line(t_token *tok);
+
+//ast_token.c
+int					tok_is(t_token *tok, char *word);
+int					is_list_end(t_token *tok);
+void				skip_newlines(t_astp *p);
+int					expect_word(t_astp *p, char *word);
+void				ast_error(t_astp *p);
+
+//ast_node.c
+t_node				*ast_node(t_astp *p, t_node_type type);
+t_node				*ast_join(t_astp *p, t_node_type type, t_node *left,
+						t_node *right);
+int					push_token(t_token **lst, const char *s,
+						t_token_type type);
+int					node_push(t_astp *p, t_token **lst, t_token *src);
+void				free_ast(t_node *node);
+
+//ast_parse.c, ast_parse_cmd.c, ast_parse_comp.c, ast_parse_case.c
+t_node				*parse_command(t_astp *p);
+t_node				*parse_list(t_astp *p);
+t_grammar_status	ast_parse(t_prompt *prompt);
+t_node				*parse_simple(t_astp *p);
+int					parse_redirs(t_astp *p, t_node *node);
+t_node				*parse_if(t_astp *p);
+t_node				*parse_loop(t_astp *p);
+t_node				*parse_group(t_astp *p);
+t_node				*parse_for(t_astp *p);
+t_node				*parse_case(t_astp *p);
+
+//ast_parse_func.c, ast_func.c, ast_call.c
+int					is_func_def(t_token *tok);
+t_node				*parse_func(t_astp *p);
+int					define_function(t_node *node, t_run *run);
+t_node				*find_function(t_shell *shell, char *name);
+void				clear_functions(t_shell *shell);
+int					call_function(t_node *def, t_cmd *cmd, t_shell *shell);
+int					run_function(t_node *def, t_cmd *cmd, t_shell *shell);
+
+//ast_exec.c
+int					execute_ast(t_node *root, t_hd *hd, t_shell *shell);
+int					run_compound(t_node *node, t_run *run);
+int					run_node(t_node *node, t_run *run);
+int					ast_stopped(t_shell *shell);
+
+//ast_cmd.c, ast_assign.c (kind: 0, ARRAY_INDEXED, ARRAY_ASSOC)
+t_hd				*hd_at(t_hd *hd, int skip);
+t_token				*expand_one(const char *raw, t_shell *shell);
+int					load_words(t_prompt *prompt, t_token *words, t_run *run,
+						int skip);
+int					run_words(t_prompt *prompt);
+int					run_cmd(t_node *node, t_run *run);
+int					run_assigned(t_prompt *prompt, int count);
+int					assign_word(t_shell *shell, char *word, int kind);
+
+//ast_array.c, ast_array_list.c
+t_array				*get_array(t_shell *shell, char *name, int kind);
+int					assign_array(t_shell *shell, char *word, int kind);
+int					set_element(t_shell *shell, t_array *arr, char *word,
+						size_t *next);
+int					fill_array(t_shell *shell, t_array *arr, char *list);
+
+//ast_loop.c, ast_for.c
+int					loop_done(t_shell *shell, int status);
+int					run_while(t_node *node, t_run *run);
+int					run_for(t_node *node, t_run *run);
+int					for_body(t_node *node, const char *value, t_run *run,
+						int *status);
+int					for_word(t_node *node, t_token *word, t_run *run,
+						int *status);
+
+//ast_case.c, ast_fork.c, ast_redir.c
+int					run_if(t_node *node, t_run *run);
+int					run_case(t_node *node, t_run *run);
+int					run_pipe(t_node *node, t_run *run);
+int					run_subshell(t_node *node, t_run *run);
+int					run_redirected(t_node *node, t_run *run);
+
+#endif
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_array.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 18:41:19 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 18:41:19 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+#include "builtins.h"
+
+// 이미 배열이면 그대로 (종류는 처음 만들 때만 정함)
+// 같은 이름의 스칼라가 있으면 0번 원소로 옮기고 envp_list에서 뺌
+t_array	*get_array(t_shell *shell, char *name, int kind)
+{
+	t_envp	*old;
+	t_array	*arr;
+	int		ok;
+
+	arr = find_array(shell, name, ft_strlen(name));
+	if (arr)
+		return (arr);
+	arr = add_array(shell, name, kind == ARRAY_ASSOC);
+	old = find_env_node(shell->envp_list, name);
+	if (!arr || !old)
+		return (arr);
+	ok = 1;
+	if (old->value && arr->assoc)
+		ok = assoc_set(arr, "0", old->value);
+	else if (old->value)
+		ok = array_set(arr, 0, old->value);
+	remove_env_node(&shell->envp_list, name);
+	if (!ok)
+		return (NULL);
+	return (arr);
+}
+
+// word의 앞 len글자를 이름으로 하는 배열
+static t_array	*array_of(t_shell *shell, char *word, size_t len, int kind)
+{
+	t_array	*arr;
+	char	*name;
+
+	name = ft_substr(word, 0, len);
+	if (!name)
+		return (NULL);
+	arr = get_array(shell, name, kind);
+	free(name);
+	return (arr);
+}
+
+// name=(...)은 원소를 모두 새로, name[k]=v는 하나만, name=v는 0번 원소
+int	assign_array(t_shell *shell, char *word, int kind)
+{
+	t_array	*arr;
+	char	*s;
+	size_t	len;
+	size_t	next;
+	int		status;
+
+	len = 0;
+	while (word[len] != '=' && word[len] != '[')
+		len++;
+	arr = array_of(shell, word, len, kind);
+	if (!arr)
+		return (perror("malloc fail : assign_array"), FAILURE);
+	next = 0;
+	if (word[len] == '[')
+		return (set_element(shell, arr, word + len, &next));
+	if (word[len + 1] == '(' && word[ft_strlen(word) - 1] == ')')
+		return (fill_array(shell, arr, word + len + 1));
+	s = ft_strjoin("[0]", word + len);
+	status = FAILURE;
+	if (s)
+		status = set_element(shell, arr, s, &next);
+	return (free(s), status);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_array_list.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 18:55:47 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 18:55:47 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+#include "input.h"
+#include "lexing.h"
+#include "expand.h"
+#include "brace.h"
+
+// [k]=v 하나, 첨자는 확장해서 (첨자 배열이면 산술식) 값은 확장 후 따옴표만 뗌
+// 첨자 배열이면 *next는 넣은 자리 다음 (뒤의 원소가 이어서 들어감)
+int	set_element(t_shell *shell, t_array *arr, char *word, size_t *next)
+{
+	char	*close;
+	char	*key;
+	t_token	*val;
+	int		status;
+
+	close = ft_strchr(word, ']');
+	key = brace_word(word + 1, close - word - 1, shell->envp_list);
+	val = expand_one(close + 2, shell);
+	status = FAILURE;
+	if (key && val && arr->assoc && assoc_set(arr, key, val->value))
+		status = SUCCESS;
+	else if (key && val && !arr->assoc
+		&& subscript_index(arr, key, shell->envp_list, next)
+		&& array_set(arr, *next, val->value))
+		status = SUCCESS;
+	*next += (status == SUCCESS);
+	free(key);
+	clear_token_list(&val);
+	return (status);
+}
+
+// BRACE 토큰({a,b}, {1..3}만 있던 단어)은 argv를 만들 때처럼 하나씩 펼침
+static int	push_brace(t_array *arr, char *word, size_t *next)
+{
+	t_brace_iter	it;
+	const char		*w;
+	int				ok;
+
+	if (brace_iter_init(&it, word) <= 0)
+		return (0);
+	ok = 1;
+	w = brace_iter_next(&it);
+	while (ok && w)
+	{
+		ok = array_set(arr, (*next)++, w);
+		w = brace_iter_next(&it);
+	}
+	ok = (ok && !it.err);
+	brace_iter_free(&it);
+	return (ok);
+}
+
+// 첨자 없는 원소는 명령 인자처럼 확장/나누기/glob 해서 차례로 뒤에 붙임
+static int	push_values(t_shell *shell, t_array *arr, char *raw, size_t *next)
+{
+	t_prompt	prompt;
+	t_token		*tok;
+	char		*value;
+	int			ok;
+
+	ft_memset(&prompt, 0, sizeof(t_prompt));
+	prompt.shell = shell;
+	prompt.envp_lst = shell->envp_list;
+	value = ft_strdup(raw);
+	ok = (value && add_new_token(&prompt.token_lst, value, T_WORD)
+			&& expand_and_split(&prompt));
+	tok = prompt.token_lst;
+	while (ok && tok)
+	{
+		if (tok->type == T_BRACE)
+			ok = push_brace(arr, tok->value, next);
+		else
+			ok = array_set(arr, (*next)++, tok->value);
+		tok = tok->next;
+	}
+	clear_token_list(&prompt.token_lst);
+	if (!ok)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+// [k]=v 꼴의 원소인지
+static int	is_keyed(char *s)
+{
+	char	*close;
+
+	if (s[0] != '[')
+		return (0);
+	close = ft_strchr(s, ']');
+	return (close && close[1] == '=');
+}
+
+// (...) 안을 다시 렉싱해서 단어마다 원소로
+// 닫는 ')'와 개행 등 단어가 아닌 토큰은 건너뜀
+// 있던 원소는 모두 지움
+// 연관 배열은 [k]=v 꼴만 받음
+int	fill_array(t_shell *shell, t_array *arr, char *list)
+{
+	t_token	*lst;
+	t_token	*tok;
+	size_t	next;
+	int		status;
+
+	array_empty(arr);
+	lst = input_lexing(list + 1, 0);
+	tok = lst;
+	next = 0;
+	status = SUCCESS;
+	while (tok && status == SUCCESS)
+	{
+		if (tok->type == T_WORD && is_keyed(tok->value))
+			status = set_element(shell, arr, tok->value, &next);
+		else if (tok->type == T_WORD && arr->assoc)
+			print_error(tok->value, "must use subscript when assigning "
+				"associative array");
+		else if (tok->type == T_WORD)
+			status = push_values(shell, arr, tok->value, &next);
+		tok = tok->next;
+	}
+	clear_token_list(&lst);
+	return (status);
+}
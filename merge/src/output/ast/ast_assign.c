@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_assign.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 14:02:13 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 14:02:13 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+#include "builtins.h"
+
+// 대입 뒤에 명령 단어나 리다이렉션이 남았는지
+static int	has_command(t_token *tok, int count)
+{
+	while (count-- > 0)
+		tok = tok->next;
+	return (tok->type != T_END);
+}
+
+// 변수는 export한 것과 같은 envp_list에 둠 (따로 된 셸 변수 목록은 없음)
+// name=(...), name[k]=v, 이미 배열인 이름, declare -a/-A (kind)는 배열로
+int	assign_word(t_shell *shell, char *word, int kind)
+{
+	t_token	*tok;
+	char	*eq;
+	int		ret;
+
+	eq = ft_strchr(word, '=');
+	if (kind || (eq[1] == '(' && word[ft_strlen(word) - 1] == ')')
+		|| ft_memchr(word, '[', eq - word)
+		|| find_array(shell, word, eq - word))
+		return (assign_array(shell, word, kind));
+	tok = expand_one(eq + 1, shell);
+	if (!tok)
+		return (FAILURE);
+	*eq = '\0';
+	ret = set_env_variable(shell, word, tok->value);
+	*eq = '=';
+	clear_token_list(&tok);
+	return (ret);
+}
+
+// 명령 앞의 대입은 그 명령 동안만: 있던 값은 saved[0], 없던 이름은 saved[1]에
+// 앞에 쌓아서 같은 이름이 두 번 나와도 거꾸로 되돌리면 원래 값이 남음
+static int	save_var(t_shell *shell, char *word, t_envp **saved)
+{
+	t_envp	*node;
+	t_envp	*old;
+	char	*key;
+	char	*value;
+
+	key = ft_substr(word, 0, ft_strchr(word, '=') - word);
+	if (!key)
+		return (0);
+	old = find_env_node(shell->envp_list, key);
+	value = NULL;
+	if (old && old->value)
+		value = ft_strdup(old->value);
+	if (old && old->value && !value)
+		return (free(key), 0);
+	node = create_envp(key, value);
+	if (!node)
+		return (free(key), free(value), 0);
+	node->next = saved[!old];
+	saved[!old] = node;
+	return (1);
+}
+
+static void	restore_vars(t_shell *shell, t_envp **saved)
+{
+	t_envp	*curr;
+
+	curr = saved[0];
+	while (curr)
+	{
+		set_env_variable(shell, curr->key, curr->value);
+		curr = curr->next;
+	}
+	curr = saved[1];
+	while (curr)
+	{
+		remove_env_node(&shell->envp_list, curr->key);
+		curr = curr->next;
+	}
+	clear_envp_list(&saved[0]);
+	clear_envp_list(&saved[1]);
+	update_env_array(shell);
+}
+
+// NAME=value 만 있으면 셸에 그대로 남기고 상태는 마지막 $( )의 것
+// 뒤에 명령이 있으면 그 명령을 실행하는 동안만 바꿨다가 되돌림
+int	run_assigned(t_prompt *prompt, int count)
+{
+	t_envp	*saved[2];
+	t_token	*tok;
+	int		temp;
+	int		status;
+
+	tok = prompt->token_lst;
+	temp = has_command(tok, count);
+	saved[0] = NULL;
+	saved[1] = NULL;
+	status = SUCCESS;
+	while (count-- > 0 && status == SUCCESS)
+	{
+		if (temp && !save_var(prompt->shell, tok->value, saved))
+			status = FAILURE;
+		else
+			status = assign_word(prompt->shell, tok->value, 0);
+		prompt->token_lst = tok->next;
+		tok->next = NULL;
+		clear_token_list(&tok);
+		tok = prompt->token_lst;
+	}
+	update_env_array(prompt->shell);
+	if (temp && status == SUCCESS)
+		status = run_words(prompt);
+	else if (status == SUCCESS)
+		status = prompt->shell->subst_status;
+	if (temp)
+		restore_vars(prompt->shell, saved);
+	return (status);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_call.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 16:03:54 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 16:03:54 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "output.h"
+
+// 호출 인자를 $1부터로 ($0은 그대로), 바깥 값은 frame에 남겨 둠
+// 인자 문자열은 호출 동안 살아 있는 cmd의 것을 그대로 가리킴
+// 본문의 break/continue가 호출한 쪽의 반복문까지 닿지 않도록 깊이는 0부터
+static int	push_frame(t_frame *frame, t_cmd *cmd, t_shell *shell)
+{
+	char	**params;
+
+	params = malloc(sizeof(char *) * (cmd->argc + 1));
+	if (!params)
+		return (perror("malloc fail : push_frame"), 0);
+	params[0] = shell->params[0];
+	ft_memcpy(params + 1, cmd->args + 1, sizeof(char *) * cmd->argc);
+	frame->params = shell->params;
+	frame->param_count = shell->param_count;
+	frame->loop_depth = shell->loop_depth;
+	frame->prev = shell->frame;
+	shell->frame = frame;
+	shell->params = params;
+	shell->param_count = cmd->argc - 1;
+	shell->loop_depth = 0;
+	return (1);
+}
+
+static void	pop_frame(t_shell *shell)
+{
+	t_frame	*frame;
+
+	frame = shell->frame;
+	free(shell->params);
+	shell->params = frame->params;
+	shell->param_count = frame->param_count;
+	shell->loop_depth = frame->loop_depth;
+	shell->frame = frame->prev;
+}
+
+// fork 없이 현재 셸에서 본문을 실행
+// 도중에 다시 정의되거나 exit으로 표가 비워져도 본문이 살아 있도록 refs를 잡아 둠
+int	call_function(t_node *def, t_cmd *cmd, t_shell *shell)
+{
+	t_frame	frame;
+	int		status;
+
+	if (!push_frame(&frame, cmd, shell))
+		return (FAILURE);
+	def->refs++;
+	status = execute_ast(def->left, def->hd, shell);
+	free_ast(def);
+	if (shell->returning)
+		status = shell->last_exit_status;
+	shell->returning = 0;
+	pop_frame(shell);
+	return (status);
+}
+
+// 파이프 없이 함수 하나면 빌트인처럼 셸의 fd를 바꿔 두고 호출한 뒤 되돌림
+int	run_function(t_node *def, t_cmd *cmd, t_shell *shell)
+{
+	int	status;
+
+	save_redirections(cmd);
+	if (setup_redirections(cmd, 0, 1) == FAILURE)
+		status = FAILURE;
+	else
+		status = call_function(def, cmd, shell);
+	fflush(stdout);
+	restore_redirections(cmd, 0);
+	if (!shell->exit_flag)
+		shell->last_exit_status = status;
+	return (SUCCESS);
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_case.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:37:50 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 15:37:50 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+#include "glob.h"
+
+// 조건이 0이면 then 본문, 아니면 next (elif의 IF 노드나 else 본문)
+int	run_if(t_node *node, t_run *run)
+{
+	int	status;
+
+	status = run_node(node->left, run);
+	if (ast_stopped(run->shell))
+		return (status);
+	if (status == 0)
+		return (run_node(node->right, run));
+	if (node->next)
+		return (run_node(node->next, run));
+	return (SUCCESS);
+}
+
+// 패턴도 확장한 뒤 따옴표 안이던 글자는 글자 그대로 비교 (glob과 같은 규칙)
+static int	case_match(t_token *raw, const char *subject, t_shell *shell)
+{
+	t_token		*tok;
+	t_pattern	pat;
+	char		*str;
+	int			ret;
+
+	tok = expand_one(raw->value, shell);
+	if (!tok)
+		return (0);
+	str = build_pattern(tok);
+	clear_token_list(&tok);
+	if (!str)
+		return (0);
+	ret = 0;
+	if (pattern_compile(&pat, str))
+		ret = pattern_match(&pat, subject);
+	pattern_free(&pat);
+	free(str);
+	return (ret);
+}
+
+// 처음 맞는 항목의 본문만 실행, 맞는 게 없으면 0
+int	run_case(t_node *node, t_run *run)
+{
+	t_token	*subject;
+	t_node	*item;
+	t_token	*pat;
+
+	subject = expand_one(node->words->value, run->shell);
+	if (!subject)
+		return (FAILURE);
+	item = node->left;
+	while (item)
+	{
+		pat = item->words;
+		while (pat && !case_match(pat, subject->value, run->shell))
+			pat = pat->next;
+		if (pat)
+			break ;
+		item = item->next;
+	}
+	clear_token_list(&subject);
+	if (!item)
+		return (SUCCESS);
+	return (run_node(item->left, run));
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_cmd.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 13:31:20 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 13:31:20 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "output.h"
+#include "input.h"
+#include "list.h"
+#include "expand.h"
+#include "remove.h"
+#include "herdoc.h"
+
+t_hd	*hd_at(t_hd *hd, int skip)
+{
+	while (hd && skip-- > 0)
+		hd = hd->next;
+	return (hd);
+}
+
+// 단어 하나를 확장하고 따옴표만 뗌 (단어 나누기, glob 없음)
+// 대입 값, case 대상과 패턴용, 따옴표 안이던 글자는 mask에 남음
+t_token	*expand_one(const char *raw, t_shell *shell)
+{
+	t_token	*tok;
+	char	*value;
+
+	value = ft_strdup(raw);
+	if (!value)
+		return (NULL);
+	tok = create_token(value, T_WORD);
+	if (!tok)
+		return (free(value), NULL);
+	if (!expand_token(tok, shell->envp_list) || !remove_quote(&tok))
+		clear_token_list(&tok);
+	return (tok);
+}
+
+// 트리의 토큰을 복사해서 한 줄처럼 다룰 prompt를 만듦
+// 렉싱과 파싱은 트리를 만들 때 끝났으므로 반복할 때마다 확장만 다시 함
+// ('$'가 있는 heredoc 본문도 여기서 다시 확장)
+int	load_words(t_prompt *prompt, t_token *words, t_run *run, int skip)
+{
+	ft_memset(prompt, 0, sizeof(t_prompt));
+	prompt->shell = run->shell;
+	prompt->envp_lst = run->shell->envp_list;
+	prompt->hd_lst = hd_at(run->hd, skip);
+	if (!expand_heredocs(prompt->hd_lst, words, run->shell))
+		return (0);
+	prompt->token_lst = dup_token_list(words);
+	return (prompt->token_lst != NULL);
+}
+
+// 확장/분리/glob 후 기존 실행기로 파이프라인 하나를 돌림
+// 확장 중에 생긴 프로세스 치환은 명령이 끝나면 회수
+int	run_words(t_prompt *prompt)
+{
+	t_pipeline	*pl;
+	t_procsub	*mark;
+	int			ret;
+	int			ok;
+
+	mark = prompt->shell->procsubs;
+	pl = NULL;
+	ret = FAILURE;
+	ok = (expand_and_split(prompt) && prompt->token_lst);
+	if (ok && prompt->token_lst->type == T_END)
+		ret = prompt->shell->subst_status;
+	else if (ok)
+		pl = parse_tokens(prompt);
+	if (pl)
+		ret = execute_pipeline(pl, prompt->shell);
+	reap_procsubs(prompt->shell, mark);
+	if (pl && ret == SUCCESS)
+		ret = prompt->shell->last_exit_status;
+	free_pipeline(pl);
+	return (ret);
+}
+
+// 앞쪽 NAME=value 는 확장 전에 떼어서 따로 처리
+// 단어가 하나도 안 남은 명령의 상태는 이 명령 안의 마지막 $( )의 것
+int	run_cmd(t_node *node, t_run *run)
+{
+	t_prompt	prompt;
+	int			count;
+	int			status;
+
+	run->shell->subst_status = 0;
+	if (!load_words(&prompt, node->words, run, node->hd_skip))
+		return (FAILURE);
+	count = assign_count(prompt.token_lst);
+	if (count)
+		status = run_assigned(&prompt, count);
+	else
+		status = run_words(&prompt);
+	clear_token_list(&prompt.token_lst);
+	return (status);
+}
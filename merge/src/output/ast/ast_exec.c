@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_exec.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 13:05:44 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 13:05:44 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "global.h"
+
+// exit, break, continue, return이 나오면 남은 목록은 건너뜀
+int	ast_stopped(t_shell *shell)
+{
+	return (shell->exit_flag || shell->loop_break || shell->loop_continue
+		|| shell->returning);
+}
+
+// ;, &&, || 목록
+static int	run_list(t_node *node, t_run *run)
+{
+	int	status;
+
+	status = run_node(node->left, run);
+	if (ast_stopped(run->shell))
+		return (status);
+	if (node->type == N_AND && status != 0)
+		return (status);
+	if (node->type == N_OR && status == 0)
+		return (status);
+	return (run_node(node->right, run));
+}
+
+// 리다이렉션을 뺀 노드 자체의 실행
+int	run_compound(t_node *node, t_run *run)
+{
+	if (node->type == N_CMD)
+		return (run_cmd(node, run));
+	if (node->type == N_SEQ || node->type == N_AND || node->type == N_OR)
+		return (run_list(node, run));
+	if (node->type == N_NOT)
+		return (run_node(node->left, run) == 0);
+	if (node->type == N_PIPE)
+		return (run_pipe(node, run));
+	if (node->type == N_IF)
+		return (run_if(node, run));
+	if (node->type == N_WHILE || node->type == N_UNTIL)
+		return (run_while(node, run));
+	if (node->type == N_FOR)
+		return (run_for(node, run));
+	if (node->type == N_CASE)
+		return (run_case(node, run));
+	if (node->type == N_SUBSHELL)
+		return (run_subshell(node, run));
+	if (node->type == N_FUNC)
+		return (define_function(node, run));
+	return (run_node(node->left, run));
+}
+
+// 노드 하나가 끝날 때마다 $?를 맞춰둠 (다음 명령의 확장이 봄)
+// 빈 노드(비어 있는 case 본문)는 0
+int	run_node(t_node *node, t_run *run)
+{
+	int	status;
+
+	if (!node)
+		return (SUCCESS);
+	if (node->redirs)
+		status = run_redirected(node, run);
+	else
+		status = run_compound(node, run);
+	run->shell->last_exit_status = status;
+	g_exit_status = status;
+	return (status);
+}
+
+// 한 줄의 트리 실행, 안에서는 마지막 명령이어도 exec으로 셸을 바꾸지 않음
+int	execute_ast(t_node *root, t_hd *hd, t_shell *shell)
+{
+	t_run	run;
+	int		status;
+
+	run.shell = shell;
+	run.hd = hd;
+	shell->ast_depth++;
+	status = run_node(root, &run);
+	shell->ast_depth--;
+	return (status);
+}
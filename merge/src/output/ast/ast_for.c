@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_for.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:03:12 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 15:03:12 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "input.h"
+#include "list.h"
+#include "brace.h"
+#include "builtins.h"
+
+// 변수에 값을 넣고 본문을 한 번, 계속 돌아도 되면 1
+int	for_body(t_node *node, const char *value, t_run *run, int *status)
+{
+	if (set_env_variable(run->shell, node->name, (char *)value) == FAILURE)
+		return (0);
+	update_env_array(run->shell);
+	*status = run_node(node->right, run);
+	return (!loop_done(run->shell, *status));
+}
+
+// 따옴표, $, glob, ~ 없이 brace만 있는 단어인지
+static int	plain_brace(const char *s)
+{
+	if (!ft_strchr(s, '{'))
+		return (0);
+	while (*s)
+		if (ft_strchr("'\"$`\\*?[~", *s++))
+			return (0);
+	return (1);
+}
+
+// {1..1000000} 같은 단어는 brace_iter로 하나씩 만들며 돎
+// 목록 전체를 펼치지 않으므로 메모리는 가장 긴 단어 하나 크기
+static int	for_brace(t_node *node, const char *word, t_run *run, int *status)
+{
+	t_brace_iter	it;
+	const char		*value;
+	int				go;
+
+	if (brace_iter_init(&it, word) <= 0)
+		return (for_body(node, word, run, status));
+	go = 1;
+	value = brace_iter_next(&it);
+	while (go && value)
+	{
+		go = for_body(node, value, run, status);
+		if (go)
+			value = brace_iter_next(&it);
+	}
+	brace_iter_free(&it);
+	return (go);
+}
+
+// 나머지 단어는 명령줄의 단어처럼 확장/분리/glob 한 결과를 돎
+static int	for_expanded(t_node *node, t_token *word, t_run *run, int *status)
+{
+	t_prompt	prompt;
+	t_token		*tok;
+	int			go;
+
+	ft_memset(&prompt, 0, sizeof(t_prompt));
+	prompt.shell = run->shell;
+	prompt.envp_lst = run->shell->envp_list;
+	go = (push_token(&prompt.token_lst, word->value, T_WORD)
+			&& push_token(&prompt.token_lst, "newline", T_END)
+			&& expand_and_split(&prompt));
+	tok = prompt.token_lst;
+	while (go && tok && tok->type != T_END)
+	{
+		go = for_body(node, tok->value, run, status);
+		tok = tok->next;
+	}
+	clear_token_list(&prompt.token_lst);
+	return (go);
+}
+
+int	for_word(t_node *node, t_token *word, t_run *run, int *status)
+{
+	if (plain_brace(word->value))
+		return (for_brace(node, word->value, run, status));
+	return (for_expanded(node, word, run, status));
+}
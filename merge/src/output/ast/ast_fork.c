@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_fork.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 16:05:29 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 16:05:29 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "executor.h"
+
+// 자식에서 노드를 돌리고 그 종료 코드로 끝냄 (자식 셸의 exit는 조용히)
+// fds가 있으면 side쪽 끝을 stdout(WRITE_END) 또는 stdin(READ_END)에 붙임
+static pid_t	fork_node(t_node *node, t_run *run, int *fds, int side)
+{
+	pid_t	pid;
+
+	fflush(stdout);
+	pid = fork_process();
+	if (pid != 0)
+		return (pid);
+	run->shell->in_subst = 1;
+	if (fds && dup2(fds[side], side == WRITE_END) == -1)
+		exit(1);
+	if (fds)
+	{
+		close(fds[READ_END]);
+		close(fds[WRITE_END]);
+	}
+	exit(run_node(node, run));
+}
+
+// 복합 명령이 낀 파이프: 양쪽을 각각 자식 셸에서 (오른쪽 종료 코드)
+int	run_pipe(t_node *node, t_run *run)
+{
+	int		fds[2];
+	pid_t	pids[2];
+
+	if (pipe(fds) == -1)
+		return (perror("pipe"), FAILURE);
+	pids[0] = fork_node(node->left, run, fds, WRITE_END);
+	pids[1] = -1;
+	if (pids[0] != -1)
+		pids[1] = fork_node(node->right, run, fds, READ_END);
+	close(fds[READ_END]);
+	close(fds[WRITE_END]);
+	if (pids[1] == -1)
+	{
+		if (pids[0] != -1)
+			waitpid(pids[0], NULL, 0);
+		return (FAILURE);
+	}
+	return (wait_for_children(pids, 2));
+}
+
+// ( 목록 ): cd, 변수, exit가 바깥 셸에 남지 않게 자식에서
+int	run_subshell(t_node *node, t_run *run)
+{
+	pid_t	pid;
+
+	pid = fork_node(node->left, run, NULL, 0);
+	if (pid == -1)
+		return (FAILURE);
+	return (wait_for_children(&pid, 1));
+}
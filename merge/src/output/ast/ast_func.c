@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_func.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:52:31 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 15:52:31 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+
+// name이 있는 칸의 항목을 가리키는 자리, 없으면 그 칸의 끝 (NULL이 든 자리)
+static t_func	**func_slot(t_shell *shell, char *name, unsigned long hash)
+{
+	t_func	**slot;
+
+	slot = &shell->funcs[hash % FUNC_BUCKETS];
+	while (*slot && ((*slot)->hash != hash
+			|| ft_strcmp((*slot)->def->name, name) != 0))
+		slot = &(*slot)->next;
+	return (slot);
+}
+
+// 본문의 heredoc은 줄이 끝나면 닫히므로 fd를 복사해 둠
+// 확장할 원문(raw)이 있으면 원문을 복사해 호출할 때마다 그때의 $1 등으로 확장
+// 노드의 hd_skip이 그대로 맞도록 줄의 목록 전체를 같은 순서로
+static int	copy_hd(t_node *def, t_hd *hd)
+{
+	t_hd	*new;
+
+	while (hd)
+	{
+		new = create_hd(-1);
+		if (!new)
+			return (0);
+		addback_hd(&def->hd, new);
+		if (hd->raw)
+			new->raw = ft_strdup(hd->raw);
+		else
+			new->fd = dup(hd->fd);
+		if (new->fd == -1 && !new->raw)
+			return (perror("copy_hd"), 0);
+		hd = hd->next;
+	}
+	return (1);
+}
+
+// 정의를 실행하면 트리를 다시 파싱하지 않고 노드째 표에 올림 (refs로 같이 쥠)
+// 반복문 안에서 같은 정의를 다시 만나도 refs만 오르내림
+int	define_function(t_node *node, t_run *run)
+{
+	t_shell			*shell;
+	t_func			**slot;
+	unsigned long	hash;
+
+	shell = run->shell;
+	if (!shell->funcs)
+		shell->funcs = ft_calloc(FUNC_BUCKETS, sizeof(t_func *));
+	if (!shell->funcs || (!node->hd && run->hd && !copy_hd(node, run->hd)))
+		return (perror("malloc fail : define_function"), FAILURE);
+	hash = hash_bytes(node->name, ft_strlen(node->name));
+	slot = func_slot(shell, node->name, hash);
+	if (!*slot)
+	{
+		*slot = ft_calloc(1, sizeof(t_func));
+		if (!*slot)
+			return (perror("malloc fail : define_function"), FAILURE);
+		(*slot)->hash = hash;
+	}
+	else
+		free_ast((*slot)->def);
+	node->refs++;
+	(*slot)->def = node;
+	return (SUCCESS);
+}
+
+// 빌트인과 PATH보다 먼저 봄, 정의가 하나도 없으면 바로 NULL
+t_node	*find_function(t_shell *shell, char *name)
+{
+	t_func	*fn;
+
+	if (!shell->funcs || !name)
+		return (NULL);
+	fn = *func_slot(shell, name, hash_bytes(name, ft_strlen(name)));
+	if (!fn)
+		return (NULL);
+	return (fn->def);
+}
+
+void	clear_functions(t_shell *shell)
+{
+	t_func	*fn;
+	t_func	*next;
+	int		i;
+
+	if (!shell->funcs)
+		return ;
+	i = 0;
+	while (i < FUNC_BUCKETS)
+	{
+		fn = shell->funcs[i++];
+		while (fn)
+		{
+			next = fn->next;
+			free_ast(fn->def);
+			free(fn);
+			fn = next;
+		}
+	}
+	free(shell->funcs);
+	shell->funcs = NULL;
+}
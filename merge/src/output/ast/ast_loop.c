@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_loop.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 14:40:37 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 14:40:37 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include <signal.h>
+
+// 본문이 끝난 뒤 이 반복문을 멈출지
+// break n, continue n(n > 1)은 한 겹씩 벗기며 바깥 반복문까지 올라감
+// exit, return은 반복문을 모두 빠져나감
+// 자식이 SIGINT로 죽었으면 (Ctrl-C) 반복 전체를 멈춤
+int	loop_done(t_shell *shell, int status)
+{
+	if (status == 128 + SIGINT)
+		return (1);
+	if (!ast_stopped(shell))
+		return (0);
+	if (shell->loop_break)
+	{
+		shell->loop_break--;
+		return (1);
+	}
+	if (shell->loop_continue > 1)
+	{
+		shell->loop_continue--;
+		return (1);
+	}
+	shell->loop_continue = 0;
+	return (shell->exit_flag || shell->returning);
+}
+
+// 조건 목록이 0이면 (until은 0이 아니면) 본문, 결과는 마지막 본문의 종료 코드
+int	run_while(t_node *node, t_run *run)
+{
+	int	status;
+	int	cond;
+
+	status = 0;
+	run->shell->loop_depth++;
+	while (1)
+	{
+		cond = run_node(node->left, run);
+		if (loop_done(run->shell, cond)
+			|| (cond == 0) != (node->type == N_WHILE))
+			break ;
+		status = run_node(node->right, run);
+		if (loop_done(run->shell, status))
+			break ;
+	}
+	run->shell->loop_depth--;
+	return (status);
+}
+
+// in이 없으면 위치 인자 $1, $2, ... 를 돎
+int	run_for(t_node *node, t_run *run)
+{
+	t_token	*word;
+	int		status;
+	int		go;
+	int		i;
+
+	status = 0;
+	go = 1;
+	run->shell->loop_depth++;
+	word = node->words;
+	while (node->has_in && go && word)
+	{
+		go = for_word(node, word, run, &status);
+		word = word->next;
+	}
+	i = 1;
+	while (!node->has_in && go && i <= run->shell->param_count)
+		go = for_body(node, run->shell->params[i++], run, &status);
+	run->shell->loop_depth--;
+	return (status);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_node.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:31:17 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 10:31:17 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+
+t_node	*ast_node(t_astp *p, t_node_type type)
+{
+	t_node	*node;
+
+	node = malloc(sizeof(t_node));
+	if (!node)
+	{
+		p->err = AST_ERR_MEM;
+		return (NULL);
+	}
+	ft_memset(node, 0, sizeof(t_node));
+	node->type = type;
+	return (node);
+}
+
+// left type right 로 묶음, 실패하면 양쪽 다 해제
+t_node	*ast_join(t_astp *p, t_node_type type, t_node *left, t_node *right)
+{
+	t_node	*node;
+
+	if (!right)
+		return (free_ast(left), NULL);
+	node = ast_node(p, type);
+	if (!node)
+		return (free_ast(left), free_ast(right), NULL);
+	node->left = left;
+	node->right = right;
+	return (node);
+}
+
+// s를 복사한 토큰을 lst 끝에 붙임
+int	push_token(t_token **lst, const char *s, t_token_type type)
+{
+	char	*value;
+
+	value = ft_strdup(s);
+	if (!value)
+		return (0);
+	return (add_new_token(lst, value, type));
+}
+
+// 트리는 줄의 토큰 목록과 따로 살도록 토큰을 복사해서 가짐
+int	node_push(t_astp *p, t_token **lst, t_token *src)
+{
+	if (!push_token(lst, src->value, src->type))
+	{
+		p->err = AST_ERR_MEM;
+		return (0);
+	}
+	return (1);
+}
+
+// 함수 표가 같이 쥐고 있는 노드(refs)는 한 번 놓기만 함
+void	free_ast(t_node *node)
+{
+	if (!node)
+		return ;
+	if (node->refs)
+	{
+		node->refs--;
+		return ;
+	}
+	clear_hd_list(&node->hd);
+	clear_token_list(&node->words);
+	clear_token_list(&node->redirs);
+	free(node->name);
+	free_ast(node->left);
+	free_ast(node->right);
+	free_ast(node->next);
+	free(node);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parse.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:46:22 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 10:46:22 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+
+// 복합 명령이면 그 뒤의 리다이렉션까지, 아니면 단순 명령 (파이프로 이어진 것까지)
+t_node	*parse_command(t_astp *p)
+{
+	t_node	*node;
+
+	if (is_list_end(p->cur) || (p->cur->type != T_WORD
+			&& !is_redir_type(p->cur->type) && p->cur->type != T_LPAREN))
+		return (ast_error(p), NULL);
+	if (is_func_def(p->cur))
+		return (parse_func(p));
+	if (!is_compound_start(p->cur))
+		return (parse_simple(p));
+	if (tok_is(p->cur, "if"))
+		node = parse_if(p);
+	else if (tok_is(p->cur, "while") || tok_is(p->cur, "until"))
+		node = parse_loop(p);
+	else if (tok_is(p->cur, "for"))
+		node = parse_for(p);
+	else if (tok_is(p->cur, "case"))
+		node = parse_case(p);
+	else
+		node = parse_group(p);
+	if (node && !parse_redirs(p, node))
+		return (free_ast(node), NULL);
+	return (node);
+}
+
+// ! 는 파이프라인 앞에만, 복합 명령이 낀 파이프는 PIPE 노드로 이음
+static t_node	*parse_pipeline(t_astp *p)
+{
+	t_node	*left;
+
+	if (tok_is(p->cur, "!"))
+	{
+		p->cur = p->cur->next;
+		left = ast_node(p, N_NOT);
+		if (left)
+			left->left = parse_pipeline(p);
+		if (left && !left->left)
+			return (free_ast(left), NULL);
+		return (left);
+	}
+	left = parse_command(p);
+	while (left && p->cur->type == T_PIPE)
+	{
+		p->cur = p->cur->next;
+		skip_newlines(p);
+		left = ast_join(p, N_PIPE, left, parse_command(p));
+	}
+	return (left);
+}
+
+static t_node	*parse_and_or(t_astp *p)
+{
+	t_node		*left;
+	t_node_type	type;
+
+	left = parse_pipeline(p);
+	while (left && (p->cur->type == T_AND || p->cur->type == T_OR))
+	{
+		type = N_AND;
+		if (p->cur->type == T_OR)
+			type = N_OR;
+		p->cur = p->cur->next;
+		skip_newlines(p);
+		left = ast_join(p, type, left, parse_pipeline(p));
+	}
+	return (left);
+}
+
+// ; 나 개행으로 이어진 and/or 목록, 목록 끝(fi, done, ) 등)에서 멈춤
+// 비어 있으면 오류
+t_node	*parse_list(t_astp *p)
+{
+	t_node	*left;
+
+	skip_newlines(p);
+	if (is_list_end(p->cur))
+		return (ast_error(p), NULL);
+	left = parse_and_or(p);
+	while (left && (p->cur->type == T_SEMI || p->cur->type == T_NEWLINE))
+	{
+		p->cur = p->cur->next;
+		skip_newlines(p);
+		if (is_list_end(p->cur))
+			break ;
+		left = ast_join(p, N_SEQ, left, parse_and_or(p));
+	}
+	if (left && !is_list_end(p->cur))
+	{
+		ast_error(p);
+		return (free_ast(left), NULL);
+	}
+	return (left);
+}
+
+// 줄 전체를 트리로 (토큰 목록은 확장 전 그대로 둠)
+// 줄 끝에서 명령이 덜 끝났으면 GRAMMAR_EOF_ERROR
+t_grammar_status	ast_parse(t_prompt *prompt)
+{
+	t_astp	p;
+
+	p.cur = prompt->token_lst;
+	p.hd = 0;
+	p.err = 0;
+	skip_newlines(&p);
+	if (p.cur->type == T_END)
+		return (GRAMMAR_OK);
+	prompt->ast = parse_list(&p);
+	if (prompt->ast && p.cur->type != T_END)
+		ast_error(&p);
+	if (!p.err)
+		return (GRAMMAR_OK);
+	free_ast(prompt->ast);
+	prompt->ast = NULL;
+	if (p.err == AST_ERR_EOF)
+		return (GRAMMAR_EOF_ERROR);
+	if (p.err == AST_ERR_MEM)
+		perror("malloc fail : ast_parse");
+	return (GRAMMAR_TOKEN_ERROR);
+}
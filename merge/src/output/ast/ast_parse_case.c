@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parse_case.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 11:41:58 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 11:41:58 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "builtins.h"
+
+// for name [in 단어...] ; do
+// in이 없으면 실행할 때 위치 인자를 돌고, in 뒤가 비어 있으면 한 번도 안 돎
+static int	for_words(t_astp *p, t_node *node)
+{
+	skip_newlines(p);
+	if (tok_is(p->cur, "in"))
+	{
+		node->has_in = 1;
+		p->cur = p->cur->next;
+		while (p->cur->type == T_WORD && node_push(p, &node->words, p->cur))
+			p->cur = p->cur->next;
+		if (p->err)
+			return (0);
+		if (p->cur->type != T_SEMI && p->cur->type != T_NEWLINE)
+			return (ast_error(p), 0);
+		p->cur = p->cur->next;
+	}
+	else if (p->cur->type == T_SEMI)
+		p->cur = p->cur->next;
+	skip_newlines(p);
+	return (expect_word(p, "do"));
+}
+
+t_node	*parse_for(t_astp *p)
+{
+	t_node	*node;
+
+	node = ast_node(p, N_FOR);
+	if (!node)
+		return (NULL);
+	p->cur = p->cur->next;
+	if (p->cur->type != T_WORD || !is_valid_identifier(p->cur->value))
+		ast_error(p);
+	else
+	{
+		node->name = ft_strdup(p->cur->value);
+		if (!node->name)
+			p->err = AST_ERR_MEM;
+		p->cur = p->cur->next;
+	}
+	if (!p->err && for_words(p, node))
+		node->right = parse_list(p);
+	if (node->right)
+		expect_word(p, "done");
+	if (p->err)
+		return (free_ast(node), NULL);
+	return (node);
+}
+
+// [(] 패턴 [| 패턴]... ) 본문 ;;  (마지막 항목은 ;; 없이 esac 가능)
+static t_node	*case_item(t_astp *p)
+{
+	t_node	*item;
+
+	item = ast_node(p, N_ITEM);
+	if (!item)
+		return (NULL);
+	if (p->cur->type == T_LPAREN)
+		p->cur = p->cur->next;
+	while (p->cur->type == T_WORD && node_push(p, &item->words, p->cur))
+	{
+		p->cur = p->cur->next;
+		if (p->cur->type != T_PIPE)
+			break ;
+		p->cur = p->cur->next;
+	}
+	if (!p->err && (!item->words || p->cur->type != T_RPAREN))
+		ast_error(p);
+	else if (!p->err)
+		p->cur = p->cur->next;
+	skip_newlines(p);
+	if (!p->err && p->cur->type != T_DSEMI && !tok_is(p->cur, "esac"))
+		item->left = parse_list(p);
+	if (!p->err && p->cur->type == T_DSEMI)
+		p->cur = p->cur->next;
+	else if (!p->err && !tok_is(p->cur, "esac"))
+		ast_error(p);
+	if (p->err)
+		return (free_ast(item), NULL);
+	return (item);
+}
+
+// case 단어 in 항목... esac, 항목은 left부터 next로 이어짐
+t_node	*parse_case(t_astp *p)
+{
+	t_node	*node;
+	t_node	**tail;
+
+	node = ast_node(p, N_CASE);
+	if (!node)
+		return (NULL);
+	p->cur = p->cur->next;
+	if (p->cur->type != T_WORD)
+		ast_error(p);
+	else if (node_push(p, &node->words, p->cur))
+		p->cur = p->cur->next;
+	skip_newlines(p);
+	expect_word(p, "in");
+	tail = &node->left;
+	while (!p->err)
+	{
+		skip_newlines(p);
+		if (tok_is(p->cur, "esac"))
+			break ;
+		*tail = case_item(p);
+		if (*tail)
+			tail = &(*tail)->next;
+	}
+	expect_word(p, "esac");
+	if (p->err)
+		return (free_ast(node), NULL);
+	return (node);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parse_cmd.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 11:02:09 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 11:02:09 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "list.h"
+
+// | 뒤가 단순 명령이면 같은 CMD 노드에 이어서 기존 파이프라인 실행기로 돌림
+// 복합 명령이 오면 여기서 끊고 PIPE 노드로
+static int	pipe_continues(t_token *pipe)
+{
+	t_token	*next;
+
+	next = pipe->next;
+	while (next->type == T_NEWLINE)
+		next = next->next;
+	if (is_redir_type(next->type))
+		return (1);
+	return (next->type == T_WORD && !is_compound_start(next)
+		&& !tok_is(next, "!") && !is_list_end(next));
+}
+
+static int	push_end(t_astp *p, t_token **lst)
+{
+	if (!push_token(lst, "newline", T_END))
+	{
+		p->err = AST_ERR_MEM;
+		return (0);
+	}
+	return (1);
+}
+
+// 구분자가 나올 때까지의 토큰을 복사 (파이프 뒤의 개행은 버림)
+// heredoc은 줄 전체에서 몇번째부터인지만 기억해 두고 fd는 실행할 때 꺼냄
+t_node	*parse_simple(t_astp *p)
+{
+	t_node			*node;
+	t_token_type	type;
+
+	node = ast_node(p, N_CMD);
+	if (!node)
+		return (NULL);
+	node->hd_skip = p->hd;
+	while (p->cur->type == T_WORD || is_redir_type(p->cur->type)
+		|| (p->cur->type == T_PIPE && pipe_continues(p->cur)))
+	{
+		p->hd += (p->cur->type == T_HEREDOC);
+		if (!node_push(p, &node->words, p->cur))
+			break ;
+		type = p->cur->type;
+		p->cur = p->cur->next;
+		if (type == T_PIPE)
+			skip_newlines(p);
+	}
+	if (p->err || !push_end(p, &node->words))
+		return (free_ast(node), NULL);
+	return (node);
+}
+
+// 복합 명령 뒤의 리다이렉션 (while ...; done < file)
+int	parse_redirs(t_astp *p, t_node *node)
+{
+	node->redir_hd_skip = p->hd;
+	while (!p->err && is_redir_type(p->cur->type))
+	{
+		p->hd += (p->cur->type == T_HEREDOC);
+		if (node_push(p, &node->redirs, p->cur))
+			p->cur = p->cur->next;
+		if (!p->err && p->cur->type == T_WORD
+			&& node_push(p, &node->redirs, p->cur))
+			p->cur = p->cur->next;
+	}
+	if (!p->err && node->redirs)
+		push_end(p, &node->redirs);
+	return (!p->err);
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parse_comp.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 11:20:36 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 11:20:36 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+
+// if/elif 조건; then 본문; 다음 elif는 next에 IF로, else 본문은 next에 그대로
+// fi는 마지막 elif가 먹음
+t_node	*parse_if(t_astp *p)
+{
+	t_node	*node;
+
+	node = ast_node(p, N_IF);
+	if (!node)
+		return (NULL);
+	p->cur = p->cur->next;
+	node->left = parse_list(p);
+	if (node->left && expect_word(p, "then"))
+		node->right = parse_list(p);
+	if (node->right && tok_is(p->cur, "elif"))
+		node->next = parse_if(p);
+	else if (node->right && tok_is(p->cur, "else"))
+	{
+		p->cur = p->cur->next;
+		node->next = parse_list(p);
+		if (node->next)
+			expect_word(p, "fi");
+	}
+	else if (node->right)
+		expect_word(p, "fi");
+	if (p->err)
+		return (free_ast(node), NULL);
+	return (node);
+}
+
+// while/until 조건; do 본문; done
+t_node	*parse_loop(t_astp *p)
+{
+	t_node	*node;
+
+	node = ast_node(p, N_WHILE);
+	if (!node)
+		return (NULL);
+	if (tok_is(p->cur, "until"))
+		node->type = N_UNTIL;
+	p->cur = p->cur->next;
+	node->left = parse_list(p);
+	if (node->left && expect_word(p, "do"))
+		node->right = parse_list(p);
+	if (node->right)
+		expect_word(p, "done");
+	if (p->err)
+		return (free_ast(node), NULL);
+	return (node);
+}
+
+// { 목록; } 은 현재 셸에서, ( 목록 ) 은 서브셸에서
+t_node	*parse_group(t_astp *p)
+{
+	t_node	*node;
+	int		sub;
+
+	sub = (p->cur->type == T_LPAREN);
+	node = ast_node(p, N_GROUP);
+	if (!node)
+		return (NULL);
+	if (sub)
+		node->type = N_SUBSHELL;
+	p->cur = p->cur->next;
+	node->left = parse_list(p);
+	if (node->left && sub && p->cur->type != T_RPAREN)
+		ast_error(p);
+	else if (node->left && sub)
+		p->cur = p->cur->next;
+	else if (node->left)
+		expect_word(p, "}");
+	if (p->err)
+		return (free_ast(node), NULL);
+	return (node);
+}
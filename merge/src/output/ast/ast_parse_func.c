@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_parse_func.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 15:40:12 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 15:40:12 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+
+// 명령 자리의 name ( ) 는 함수 정의 (예약어와 대입은 이름이 될 수 없음)
+int	is_func_def(t_token *tok)
+{
+	if (tok->type != T_WORD || is_reserved(tok) || is_assignment(tok->value))
+		return (0);
+	tok = tok->next;
+	return (tok && tok->type == T_LPAREN
+		&& tok->next && tok->next->type == T_RPAREN);
+}
+
+// name ( ) 뒤에는 개행이 와도 되고 본문은 복합 명령이어야 함
+// 본문 뒤의 리다이렉션은 본문에 붙어서 호출할 때마다 적용됨
+t_node	*parse_func(t_astp *p)
+{
+	t_node	*node;
+
+	node = ast_node(p, N_FUNC);
+	if (!node)
+		return (NULL);
+	node->name = ft_strdup(p->cur->value);
+	if (!node->name)
+	{
+		p->err = AST_ERR_MEM;
+		return (free_ast(node), NULL);
+	}
+	p->cur = p->cur->next->next->next;
+	skip_newlines(p);
+	if (!is_compound_start(p->cur))
+		return (ast_error(p), free_ast(node), NULL);
+	node->left = parse_command(p);
+	if (!node->left)
+		return (free_ast(node), NULL);
+	return (node);
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_redir.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 16:21:03 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 16:21:03 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+#include "input.h"
+#include "output.h"
+#include "list.h"
+
+// 복합 명령 뒤의 리다이렉션은 셸 안에서 도는 빌트인처럼
+// 셸의 fd를 바꿔 두고 본문을 돌린 뒤 되돌림 (while read ...; done < file)
+int	run_redirected(t_node *node, t_run *run)
+{
+	t_prompt	prompt;
+	t_pipeline	*pl;
+	int			status;
+
+	pl = NULL;
+	if (load_words(&prompt, node->redirs, run, node->redir_hd_skip)
+		&& expand_and_split(&prompt) && prompt.token_lst)
+		pl = parse_tokens(&prompt);
+	clear_token_list(&prompt.token_lst);
+	if (!pl)
+		return (FAILURE);
+	save_redirections(&pl->cmds[0]);
+	status = FAILURE;
+	if (setup_redirections(&pl->cmds[0], 0, 1) == SUCCESS)
+		status = run_compound(node, run);
+	fflush(stdout);
+	restore_redirections(&pl->cmds[0], 0);
+	free_pipeline(pl);
+	return (status);
+}
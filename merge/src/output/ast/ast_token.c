@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_token.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:24:51 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 10:24:51 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+
+int	tok_is(t_token *tok, char *word)
+{
+	return (tok->type == T_WORD && ft_strcmp(tok->value, word) == 0);
+}
+
+// 목록이 끝나는 자리: 줄 끝, ), ;;, 복합 명령을 닫거나 나누는 예약어
+int	is_list_end(t_token *tok)
+{
+	if (tok->type == T_END || tok->type == T_RPAREN || tok->type == T_DSEMI)
+		return (1);
+	return (tok_is(tok, "then") || tok_is(tok, "elif") || tok_is(tok, "else")
+		|| tok_is(tok, "fi") || tok_is(tok, "do") || tok_is(tok, "done")
+		|| tok_is(tok, "esac") || tok_is(tok, "}"));
+}
+
+void	skip_newlines(t_astp *p)
+{
+	while (p->cur->type == T_NEWLINE)
+		p->cur = p->cur->next;
+}
+
+// 다음이 word면 넘기고 1, 아니면 문법 오류
+int	expect_word(t_astp *p, char *word)
+{
+	if (p->err)
+		return (0);
+	if (!tok_is(p->cur, word))
+		return (ast_error(p), 0);
+	p->cur = p->cur->next;
+	return (1);
+}
+
+// 처음 난 오류만 기록, 줄 끝에서 막히면 아직 덜 끝난 명령 (다음 줄을 더 읽음)
+// 아니면 그 토큰을 T_ERROR로 바꿔서 syntax_print가 찾게 함
+void	ast_error(t_astp *p)
+{
+	if (p->err)
+		return ;
+	if (p->cur->type == T_END)
+	{
+		p->err = AST_ERR_EOF;
+		return ;
+	}
+	p->err = AST_ERR_TOKEN;
+	p->cur->type = T_ERROR;
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_word.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:20:05 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 10:20:05 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ast.h"
+
+// NAME=... 또는 NAME[k]=... 꼴, 이름에는 따옴표나 $ 없이 글자/숫자/_ 만
+int	is_assignment(const char *s)
+{
+	size_t	i;
+
+	if (!ft_isalpha(s[0]) && s[0] != '_')
+		return (0);
+	i = 1;
+	while (ft_isalnum(s[i]) || s[i] == '_')
+		i++;
+	if (s[i] == '[' && ft_strchr(s + i, ']'))
+		i = ft_strchr(s + i, ']') - s + 1;
+	return (s[i] == '=');
+}
+
+// 명령 앞에 붙은 대입 단어 수
+int	assign_count(t_token *tok)
+{
+	int	count;
+
+	count = 0;
+	while (tok->type == T_WORD && is_assignment(tok->value))
+	{
+		count++;
+		tok = tok->next;
+	}
+	return (count);
+}
+
+// 명령 자리에서만 예약어 (echo if 의 if는 그냥 단어)
+int	is_reserved(t_token *tok)
+{
+	static char			*words[] = {"if", "then", "elif", "else", "fi",
+		"while", "until", "for", "do", "done", "case", "esac", "{", "}",
+		"!", NULL};
+	int					i;
+
+	if (tok->type != T_WORD)
+		return (0);
+	i = 0;
+	while (words[i])
+		if (ft_strcmp(tok->value, words[i++]) == 0)
+			return (1);
+	return (0);
+}
+
+// 복합 명령을 여는 토큰
+int	is_compound_start(t_token *tok)
+{
+	if (tok->type == T_LPAREN)
+		return (1);
+	return (tok_is(tok, "if") || tok_is(tok, "while") || tok_is(tok, "until")
+		|| tok_is(tok, "for") || tok_is(tok, "case") || tok_is(tok, "{"));
+}
+
+// 파이프라인 하나뿐인 줄은 예전처럼 바로 파싱/실행하고
+// 목록 연산자, 괄호, 개행, 명령 자리의 예약어나 대입이 있으면 트리로 파싱
+int	is_compound_line(t_token *tok)
+{
+	int	cmd_pos;
+
+	cmd_pos = 1;
+	while (tok && tok->type != T_END)
+	{
+		if (tok->type == T_SEMI || tok->type == T_AND || tok->type == T_OR
+			|| tok->type == T_DSEMI || tok->type == T_LPAREN
+			|| tok->type == T_RPAREN || tok->type == T_NEWLINE)
+			return (1);
+		if (cmd_pos && (is_reserved(tok) || (tok->type == T_WORD
+					&& is_assignment(tok->value))))
+			return (1);
+		cmd_pos = (tok->type == T_PIPE);
+		tok = tok->next;
+	}
+	return (0);
+}
@@ -19,18 +19,45 @@
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
+# define READ_BLOCK 4096
+
+//read가 모으는 한 줄, mask는 \로 escape된 글자를 MASK_QUOTED로 표시
+typedef struct s_rd
+{
+	t_sbuf	val;
+	t_sbuf	mask;
+	char	delim;
+	int		raw;
+	int		escaped;
+}	t_rd;
 
 int		is_builtin_command(char *cmd);
+int		is_pure_builtin(char *cmd);
+int		echo_output(t_cmd *cmd, t_sbuf *out);
+int		pwd_output(t_sbuf *out);
+int		env_output(t_shell *shell, t_sbuf *out);
 int		ft_cd(t_cmd *cmd, t_shell *shell);
 int		ft_echo(t_cmd *cmd);
 int		ft_env(t_shell *shell);
 int		ft_exit(t_cmd *cmd, t_shell *shell);
+int		ft_exec(t_cmd *cmd, t_shell *shell);
+int		ft_source(t_cmd *cmd, t_shell *shell);
+int		ft_break(t_cmd *cmd, t_shell *shell);
+int		ft_return(t_cmd *cmd, t_shell *shell);
+int		ft_read(t_cmd *cmd, t_shell *shell);
+int		read_line(t_rd *rd, int fd);
+int		read_assign(t_rd *rd, char **names, t_shell *shell);
+int		ft_declare(t_cmd *cmd, t_shell *shell);
+int		declare_print(t_shell *shell, char *name);
+int		ft_mapfile(t_cmd *cmd, t_shell *shell);
 int		ft_export(t_cmd *cmd, t_shell *shell);
 void	display_all_exports(t_shell *shell);
 int	set_env_variable(t_shell *shell, char *key, char *value);
 void	update_env_array(t_shell *shell);
+int		ready_env_array(t_shell *shell);
 int		ft_pwd(void);
 int		ft_unset(t_cmd *cmd, t_shell *shell);
+void	remove_env_node(t_envp **envp_list, char *key);
 
 int		is_valid_identifier(char *name);
 char	*extract_key2(char *arg);
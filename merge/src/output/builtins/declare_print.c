@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   declare_print.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 19:24:51 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 19:24:51 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "list.h"
+
+// 값은 큰따옴표 안에, " \ $ ` 앞에는 \ 를 붙임
+static int	quote_value(t_sbuf *out, const char *s)
+{
+	int	ok;
+
+	ok = sbuf_addc(out, '"');
+	while (ok && *s)
+	{
+		if (ft_strchr("\"\\$`", *s))
+			ok = sbuf_addc(out, '\\');
+		ok = (ok && sbuf_addc(out, *s++));
+	}
+	return (ok && sbuf_addc(out, '"'));
+}
+
+// declare -a a=([0]="x" [1]="y")
+// 연관 배열은 bash처럼 원소마다 뒤에 공백: declare -A m=([k]="v" )
+static int	print_array(t_sbuf *out, t_array *arr)
+{
+	t_aiter	it;
+	int		ok;
+	int		n;
+
+	ft_memset(&it, 0, sizeof(t_aiter));
+	if (arr->assoc)
+		ok = sbuf_append(out, "declare -A ", 11);
+	else
+		ok = sbuf_append(out, "declare -a ", 11);
+	ok = (ok && sbuf_append(out, arr->name, ft_strlen(arr->name))
+			&& sbuf_append(out, "=(", 2));
+	n = 0;
+	while (ok && array_next(arr, &it))
+	{
+		if (n++ && !arr->assoc)
+			ok = sbuf_addc(out, ' ');
+		ok = (ok && sbuf_addc(out, '[')
+				&& sbuf_append(out, it.key, ft_strlen(it.key))
+				&& sbuf_append(out, "]=", 2) && quote_value(out, it.value));
+		if (arr->assoc)
+			ok = (ok && sbuf_addc(out, ' '));
+	}
+	return (ok && sbuf_append(out, ")\n", 2));
+}
+
+// 변수는 모두 export된 것이라 -x
+static int	print_var(t_sbuf *out, t_shell *shell, char *name)
+{
+	t_envp	*var;
+
+	var = find_env_node(shell->envp_list, name);
+	if (!var)
+		return (ft_putstr_fd("minishell: declare: ", 2), ft_putstr_fd(name, 2),
+			ft_putendl_fd(": not found", 2), 0);
+	if (!var->value)
+		return (sbuf_append(out, "declare -x ", 11)
+			&& sbuf_append(out, var->key, ft_strlen(var->key))
+			&& sbuf_addc(out, '\n'));
+	return (sbuf_append(out, "declare -x ", 11)
+		&& sbuf_append(out, var->key, ft_strlen(var->key))
+		&& sbuf_addc(out, '=') && quote_value(out, var->value)
+		&& sbuf_addc(out, '\n'));
+}
+
+static int	print_all(t_sbuf *out, t_shell *shell)
+{
+	t_array	*arr;
+	int		i;
+
+	i = 0;
+	while (shell->arrays && i < ARRAY_BUCKETS)
+	{
+		arr = shell->arrays[i++];
+		while (arr)
+		{
+			if (!print_array(out, arr))
+				return (0);
+			arr = arr->next;
+		}
+	}
+	return (1);
+}
+
+// name이 NULL이면 배열 전부, 아니면 그 배열이나 변수 하나
+int	declare_print(t_shell *shell, char *name)
+{
+	t_sbuf	out;
+	t_array	*arr;
+	int		ok;
+
+	arr = NULL;
+	if (name)
+		arr = find_array(shell, name, ft_strlen(name));
+	if (!sbuf_init(&out, 0))
+		return (FAILURE);
+	if (arr)
+		ok = print_array(&out, arr);
+	else if (name)
+		ok = print_var(&out, shell, name);
+	else
+		ok = print_all(&out, shell);
+	ok = (ok && sbuf_flush(&out, STDOUT_FILENO));
+	sbuf_free(&out);
+	if (!ok)
+		return (FAILURE);
+	return (SUCCESS);
+}
@@ -82,12 +82,15 @@ int	set_env_variable(t_shell *shell, char *key, char *value)
 	return (SUCCESS);
 }
 
+// 환경이 바뀔 때마다 세대 번호를 올려서 캐시된 확장 결과를 무효화
+// execve용 배열은 버리기만 하고 필요할 때 ready_env_array가 다시 만듦
+// (루프 변수처럼 자주 바뀌어도 매번 배열 전체를 만들지 않음)
 void	update_env_array(t_shell *shell)
 {
+	shell->env_gen++;
 	if (shell->env_array)
 	{
-		free(shell->env_array);
+		free_env_array(shell->env_array);
 		shell->env_array = NULL;
 	}
-	shell->env_array = env_list_to_array(shell->envp_list);
 }
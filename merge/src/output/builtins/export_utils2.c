@@ -69,6 +69,14 @@ char	*extract_value(char *arg)
 	return (value);
 }
 
+// execve 직전에 환경 배열이 없으면 (update_env_array 뒤) 새로 만듦
+int	ready_env_array(t_shell *shell)
+{
+	if (!shell->env_array)
+		shell->env_array = env_list_to_array(shell->envp_list);
+	return (shell->env_array != NULL);
+}
+
 t_envp	*find_env_node(t_envp *envp_list, char *key)
 {
 	t_envp	*current;
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_break.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 16:48:15 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 16:48:15 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+
+// break/continue 뒤의 n (없으면 1, 반복문 깊이보다 크면 가장 바깥까지)
+// 숫자가 아니거나 1보다 작으면 0
+static int	loop_count(t_cmd *cmd, t_shell *shell)
+{
+	long	n;
+	int		i;
+
+	if (!cmd->args[1])
+		return (1);
+	n = 0;
+	i = 0;
+	while (ft_isdigit(cmd->args[1][i]) && n <= shell->loop_depth)
+		n = n * 10 + cmd->args[1][i++] - '0';
+	if (cmd->args[1][i] && !ft_isdigit(cmd->args[1][i]))
+		return (print_error(cmd->args[1], "numeric argument required"), 0);
+	if (n < 1 || !i)
+		return (print_error(cmd->args[1], "loop count out of range"), 0);
+	if (n > shell->loop_depth)
+		n = shell->loop_depth;
+	return ((int)n);
+}
+
+// 반복문 실행기가 loop_break/loop_continue를 보고 n겹을 빠져나감
+int	ft_break(t_cmd *cmd, t_shell *shell)
+{
+	int	n;
+
+	if (!shell->loop_depth)
+		return (print_error(cmd->args[0],
+				"only meaningful in a `for', `while', or `until' loop"), 0);
+	n = loop_count(cmd, shell);
+	if (!n)
+		return (FAILURE);
+	if (ft_strcmp(cmd->args[0], "continue") == 0)
+		shell->loop_continue = n;
+	else
+		shell->loop_break = n;
+	return (SUCCESS);
+}
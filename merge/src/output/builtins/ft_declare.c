@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_declare.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 19:10:26 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 19:10:26 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "ast.h"
+#include "list.h"
+
+// -a, -A, -p (붙여 써도 됨), 옵션 뒤 첫 이름의 위치, 잘못된 옵션이면 0
+static int	declare_options(t_cmd *cmd, int *kind, int *print)
+{
+	int		i;
+	char	*opt;
+
+	i = 1;
+	while (cmd->args[i] && cmd->args[i][0] == '-' && cmd->args[i][1])
+	{
+		opt = cmd->args[i++] + 1;
+		if (ft_strcmp(opt, "-") == 0)
+			break ;
+		while (*opt == 'a' || *opt == 'A' || *opt == 'p')
+		{
+			if (*opt == 'a' && *kind != ARRAY_ASSOC)
+				*kind = ARRAY_INDEXED;
+			else if (*opt == 'A')
+				*kind = ARRAY_ASSOC;
+			else if (*opt == 'p')
+				*print = 1;
+			opt++;
+		}
+		if (*opt)
+			return (print_error("declare", "invalid option"), 0);
+	}
+	return (i);
+}
+
+// 값이 있으면 대입 (kind가 있으면 배열로), -a/-A만 있으면 빈 배열을 만듦
+static int	declare_one(t_shell *shell, char *arg, int kind)
+{
+	char	*eq;
+
+	eq = ft_strchr(arg, '=');
+	if (eq && is_assignment(arg))
+		return (assign_word(shell, arg, kind));
+	if (eq || !is_valid_identifier(arg))
+		return (print_error("declare", "not a valid identifier"), FAILURE);
+	if (kind && !get_array(shell, arg, kind))
+		return (perror("malloc fail : declare"), FAILURE);
+	return (SUCCESS);
+}
+
+// declare [-a|-A|-p] [name[=value] ...]
+// 인자는 이미 확장된 뒤라 name=(...) 안의 단어는 한번 더 렉싱/확장됨
+// -p나 이름이 없으면 declare 꼴로 출력
+int	ft_declare(t_cmd *cmd, t_shell *shell)
+{
+	int	kind;
+	int	print;
+	int	status;
+	int	i;
+
+	kind = 0;
+	print = 0;
+	i = declare_options(cmd, &kind, &print);
+	if (i == 0)
+		return (2);
+	if (!cmd->args[i])
+		return (declare_print(shell, NULL));
+	status = SUCCESS;
+	while (cmd->args[i])
+	{
+		if (print && declare_print(shell, cmd->args[i]) != SUCCESS)
+			status = FAILURE;
+		else if (!print && declare_one(shell, cmd->args[i], kind) != SUCCESS)
+			status = FAILURE;
+		i++;
+	}
+	update_env_array(shell);
+	return (status);
+}
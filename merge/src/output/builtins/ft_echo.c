@@ -28,7 +28,8 @@ static int	is_n_option(char *arg)
 	return (1);
 }
 
-int	ft_echo(t_cmd *cmd)
+//출력할 내용을 out에 모음 (명령 치환에서는 이 버퍼를 그대로 씀)
+int	echo_output(t_cmd *cmd, t_sbuf *out)
 {
 	int	i;
 	int	new_line;
@@ -44,12 +45,28 @@ int	ft_echo(t_cmd *cmd)
 	}
 	while (cmd->args[i])
 	{
-		printf("%s", cmd->args[i]);
-		if (cmd->args[i + 1])
-			printf(" ");
+		if (!sbuf_append(out, cmd->args[i], ft_strlen(cmd->args[i])))
+			return (FAILURE);
+		if (cmd->args[i + 1] && !sbuf_addc(out, ' '))
+			return (FAILURE);
 		i++;
 	}
-	if (new_line)
-		printf("\n");
+	if (new_line && !sbuf_addc(out, '\n'))
+		return (FAILURE);
 	return (SUCCESS);
 }
+
+//한 번의 write로 출력 (stdio 버퍼가 fork된 자식에 복사되지 않게)
+int	ft_echo(t_cmd *cmd)
+{
+	t_sbuf	out;
+	int		ret;
+
+	if (!sbuf_init(&out, 0))
+		return (FAILURE);
+	ret = echo_output(cmd, &out);
+	if (ret == SUCCESS && !sbuf_flush(&out, STDOUT_FILENO))
+		ret = FAILURE;
+	sbuf_free(&out);
+	return (ret);
+}
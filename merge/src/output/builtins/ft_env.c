@@ -12,7 +12,7 @@
 
 #include "builtins.h"
 
-int	ft_env(t_shell *shell)
+int	env_output(t_shell *shell, t_sbuf *out)
 {
 	t_envp	*current;
 
@@ -22,8 +22,29 @@ int	ft_env(t_shell *shell)
 	while (current)
 	{
 		if (current->key && current->value)
-			printf("%s=%s\n", current->key, current->value);
+		{
+			if (!sbuf_append(out, current->key, ft_strlen(current->key))
+				|| !sbuf_addc(out, '=')
+				|| !sbuf_append(out, current->value,
+					ft_strlen(current->value))
+				|| !sbuf_addc(out, '\n'))
+				return (FAILURE);
+		}
 		current = current->next;
 	}
 	return (SUCCESS);
 }
+
+int	ft_env(t_shell *shell)
+{
+	t_sbuf	out;
+	int		ret;
+
+	if (!sbuf_init(&out, 0))
+		return (FAILURE);
+	ret = env_output(shell, &out);
+	if (ret == SUCCESS && !sbuf_flush(&out, STDOUT_FILENO))
+		ret = FAILURE;
+	sbuf_free(&out);
+	return (ret);
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_exec.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 16:40:18 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/17 16:40:18 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "executor.h"
+#include "sigft.h"
+
+// exec cmd args...: 리다이렉션은 이미 붙어 있으니 셸을 그 명령으로 바꿈
+// exec만 있으면 할 일 없음 (리다이렉션을 남기는 건 handle_single_builtin)
+// 실패하면 스크립트에서는 bash처럼 셸을 끝내고, 대화형이면 계속
+int	ft_exec(t_cmd *cmd, t_shell *shell)
+{
+	t_cmd	target;
+	int		status;
+
+	if (!cmd->args[1])
+		return (SUCCESS);
+	target = *cmd;
+	target.args = cmd->args + 1;
+	target.argc = cmd->argc - 1;
+	fflush(stdout);
+	setup_signals_child();
+	status = execute_external(&target, shell);
+	if (shell->script)
+	{
+		shell->exit_flag = 1;
+		shell->last_exit_status = status;
+	}
+	else
+		setup_signals_interactive();
+	return (status);
+}
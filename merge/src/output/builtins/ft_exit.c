@@ -56,7 +56,8 @@ int	ft_exit(t_cmd *cmd, t_shell *shell)
 {
 	long	code;
 
-	printf("exit\n");
+	if (!shell->in_subst)
+		ft_putendl_fd("exit", STDERR_FILENO);
 	if (!cmd->args[1])
 		code = shell->last_exit_status;
 	else if (!is_numeric(cmd->args[1]))
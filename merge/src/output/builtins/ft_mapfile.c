@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_mapfile.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 19:41:08 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 19:41:08 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "ast.h"
+#include "list.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// 줄마다 원소 하나 (-t면 끝의 개행을 뗌), 다음 개행은 memchr로 찾음
+static int	load_lines(t_array *arr, const char *p, size_t n, int trim)
+{
+	const char	*nl;
+	size_t		len;
+	size_t		keep;
+	char		*line;
+
+	while (n)
+	{
+		nl = ft_memchr(p, '\n', n);
+		len = n;
+		if (nl)
+			len = nl - p + 1;
+		keep = len - (trim && nl);
+		line = malloc(keep + 1);
+		if (!line)
+			return (0);
+		ft_memcpy(line, p, keep);
+		line[keep] = '\0';
+		if (!array_put(arr, arr->len, line))
+			return (0);
+		p += len;
+		n -= len;
+	}
+	return (1);
+}
+
+// 일반 파일이면 지금 위치부터 끝까지를 mmap 한번으로 보고 끝으로 lseek
+// mmap은 페이지 단위로만 시작할 수 있어서 0부터 잡고 위치만큼 건너뜀
+// 일반 파일이 아니거나 크기를 모르면 -1 (read로 읽음)
+static int	map_input(t_array *arr, int fd, int trim)
+{
+	struct stat	st;
+	off_t		pos;
+	char		*data;
+	int			ok;
+
+	pos = lseek(fd, 0, SEEK_CUR);
+	if (pos < 0 || fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)
+		|| st.st_size == 0)
+		return (-1);
+	if (pos >= st.st_size)
+		return (1);
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+		return (-1);
+	ok = load_lines(arr, data + pos, st.st_size - pos, trim);
+	munmap(data, st.st_size);
+	lseek(fd, st.st_size, SEEK_SET);
+	return (ok);
+}
+
+// 파이프 등은 EOF까지 한번에 읽어서 같은 방식으로 나눔
+static int	read_input(t_array *arr, int fd, int trim)
+{
+	t_sbuf	sb;
+	int		ok;
+
+	if (!sbuf_init(&sb, 0))
+		return (0);
+	ok = (read_all(fd, &sb) && load_lines(arr, sb.data, sb.len, trim));
+	sbuf_free(&sb);
+	return (ok);
+}
+
+// [-t] [name], 이름이 없으면 MAPFILE, 잘못되면 NULL
+static char	*mapfile_args(t_cmd *cmd, int *trim)
+{
+	int	i;
+
+	i = 1;
+	while (cmd->args[i] && ft_strcmp(cmd->args[i], "-t") == 0)
+	{
+		*trim = 1;
+		i++;
+	}
+	if (cmd->args[i] && cmd->args[i][0] == '-')
+		return (print_error(cmd->args[0], "invalid option"), NULL);
+	if (!cmd->args[i])
+		return ("MAPFILE");
+	if (!is_valid_identifier(cmd->args[i]) || cmd->args[i + 1])
+		return (print_error(cmd->args[0], "not a valid identifier"), NULL);
+	return (cmd->args[i]);
+}
+
+// mapfile [-t] [name] (readarray도 같음): stdin을 끝까지 읽어 첨자 배열로
+int	ft_mapfile(t_cmd *cmd, t_shell *shell)
+{
+	t_array	*arr;
+	char	*name;
+	int		trim;
+	int		ok;
+
+	trim = 0;
+	name = mapfile_args(cmd, &trim);
+	if (!name)
+		return (2);
+	arr = get_array(shell, name, ARRAY_INDEXED);
+	if (!arr)
+		return (perror("malloc fail : mapfile"), FAILURE);
+	if (arr->assoc)
+		return (print_error(name, "not an indexed array"), FAILURE);
+	array_empty(arr);
+	ok = map_input(arr, STDIN_FILENO, trim);
+	if (ok == -1)
+		ok = read_input(arr, STDIN_FILENO, trim);
+	update_env_array(shell);
+	if (!ok)
+		return (perror("mapfile"), FAILURE);
+	return (SUCCESS);
+}
@@ -16,26 +16,40 @@ int	is_builtin_command(char *cmd)
 {
 	if (!cmd)
 		return (0);
-	if (ft_strcmp(cmd, "echo") == 0)
+	if (ft_strcmp(cmd, "echo") == 0 || ft_strcmp(cmd, "cd") == 0
+		|| ft_strcmp(cmd, "pwd") == 0 || ft_strcmp(cmd, "exit") == 0)
 		return (1);
-	if (ft_strcmp(cmd, "cd") == 0)
+	if (ft_strcmp(cmd, "export") == 0 || ft_strcmp(cmd, "unset") == 0
+		|| ft_strcmp(cmd, "env") == 0)
 		return (1);
-	if (ft_strcmp(cmd, "pwd") == 0)
+	if (ft_strcmp(cmd, "exec") == 0 || ft_strcmp(cmd, "source") == 0
+		|| ft_strcmp(cmd, ".") == 0)
 		return (1);
-	if (ft_strcmp(cmd, "export") == 0)
+	if (ft_strcmp(cmd, "break") == 0 || ft_strcmp(cmd, "continue") == 0
+		|| ft_strcmp(cmd, "return") == 0 || ft_strcmp(cmd, "read") == 0)
 		return (1);
-	if (ft_strcmp(cmd, "unset") == 0)
+	if (ft_strcmp(cmd, ":") == 0 || ft_strcmp(cmd, "true") == 0
+		|| ft_strcmp(cmd, "false") == 0)
 		return (1);
-	if (ft_strcmp(cmd, "env") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "exit") == 0)
+	if (ft_strcmp(cmd, "declare") == 0 || ft_strcmp(cmd, "mapfile") == 0
+		|| ft_strcmp(cmd, "readarray") == 0)
 		return (1);
 	return (0);
 }
 
-int	ft_pwd(void)
+//셸 상태를 바꾸지 않는 빌트인 (명령 치환에서 fork 없이 돌려도 되는 것)
+int	is_pure_builtin(char *cmd)
+{
+	if (!cmd)
+		return (0);
+	return (ft_strcmp(cmd, "echo") == 0 || ft_strcmp(cmd, "pwd") == 0
+		|| ft_strcmp(cmd, "env") == 0);
+}
+
+int	pwd_output(t_sbuf *out)
 {
 	char	*cwd;
+	int		ret;
 
 	cwd = getcwd(NULL, 0);
 	if (!cwd)
@@ -43,7 +57,23 @@ int	ft_pwd(void)
 		perror("pwd");
 		return (FAILURE);
 	}
-	printf("%s\n", cwd);
+	ret = SUCCESS;
+	if (!sbuf_append(out, cwd, ft_strlen(cwd)) || !sbuf_addc(out, '\n'))
+		ret = FAILURE;
 	free(cwd);
-	return (SUCCESS);
+	return (ret);
+}
+
+int	ft_pwd(void)
+{
+	t_sbuf	out;
+	int		ret;
+
+	if (!sbuf_init(&out, 0))
+		return (FAILURE);
+	ret = pwd_output(&out);
+	if (ret == SUCCESS && !sbuf_flush(&out, STDOUT_FILENO))
+		ret = FAILURE;
+	sbuf_free(&out);
+	return (ret);
 }
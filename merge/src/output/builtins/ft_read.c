@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_read.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 16:48:02 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 16:48:02 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+
+// 붙여 쓴 옵션 한 묶음 (-r, -d c, -rd c, -d:), -d가 다음 인자를 쓰면 *i를 넘김
+static int	read_flag(t_cmd *cmd, char *opt, int *i, t_rd *rd)
+{
+	while (*opt == 'r')
+	{
+		rd->raw = 1;
+		opt++;
+	}
+	if (!*opt)
+		return (1);
+	if (*opt != 'd')
+		return (print_error("read", "invalid option"), 0);
+	if (opt[1])
+		rd->delim = opt[1];
+	else if (cmd->args[*i])
+		rd->delim = cmd->args[(*i)++][0];
+	else
+		return (print_error("read", "-d: option requires an argument"), 0);
+	return (1);
+}
+
+// 옵션 뒤 첫 이름의 위치, 잘못된 옵션이면 0
+static int	read_options(t_cmd *cmd, t_rd *rd)
+{
+	int	i;
+
+	i = 1;
+	while (cmd->args[i] && cmd->args[i][0] == '-' && cmd->args[i][1])
+	{
+		if (ft_strcmp(cmd->args[i], "--") == 0)
+			return (i + 1);
+		i++;
+		if (!read_flag(cmd, cmd->args[i - 1] + 1, &i, rd))
+			return (0);
+	}
+	return (i);
+}
+
+static int	valid_names(char **names)
+{
+	while (*names)
+	{
+		if (!is_valid_identifier(*names))
+			return (print_error(*names, "not a valid identifier"), 0);
+		names++;
+	}
+	return (1);
+}
+
+// read [-r] [-d delim] [name ...]: 한 줄을 읽어 IFS로 나눠 변수에 넣음
+// 구분자 전에 EOF면 읽은 만큼은 넣고 1 (while read 반복의 끝)
+int	ft_read(t_cmd *cmd, t_shell *shell)
+{
+	t_rd	rd;
+	int		i;
+	int		ret;
+
+	ft_memset(&rd, 0, sizeof(t_rd));
+	rd.delim = '\n';
+	i = read_options(cmd, &rd);
+	if (!i)
+		return (2);
+	if (!valid_names(cmd->args + i))
+		return (FAILURE);
+	ret = -1;
+	if (sbuf_init(&rd.val, 0) && sbuf_init(&rd.mask, 0))
+		ret = read_line(&rd, STDIN_FILENO);
+	if (ret < 0)
+		print_error("read", strerror(errno));
+	else if (!read_assign(&rd, cmd->args + i, shell))
+		ret = -1;
+	sbuf_free(&rd.val);
+	sbuf_free(&rd.mask);
+	if (ret == 1)
+		return (SUCCESS);
+	return (FAILURE);
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_return.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 16:12:40 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 16:12:40 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+
+// return 뒤의 n을 0~255로 (음수는 bash처럼 256에서 뺌), 숫자가 아니면 -1
+static int	return_code(char *arg)
+{
+	long	n;
+	int		i;
+	int		start;
+
+	start = (arg[0] == '-' || arg[0] == '+');
+	i = start;
+	n = 0;
+	while (ft_isdigit(arg[i]))
+		n = (n * 10 + arg[i++] - '0') % 256;
+	if (i == start || arg[i])
+		return (-1);
+	if (arg[0] == '-')
+		n = (256 - n) % 256;
+	return ((int)n);
+}
+
+// return [n]: 함수(또는 source 중인 파일)의 남은 명령을 건너뛰고 n으로 끝냄
+// n이 없으면 바로 앞 명령의 종료 코드, 실행기는 returning을 보고 멈춤
+int	ft_return(t_cmd *cmd, t_shell *shell)
+{
+	int	code;
+
+	if (!shell->frame && !shell->source_depth)
+		return (print_error(cmd->args[0],
+				"can only `return' from a function or sourced script"), 2);
+	shell->returning = 1;
+	if (!cmd->args[1])
+		return (shell->last_exit_status);
+	code = return_code(cmd->args[1]);
+	if (code < 0)
+		return (print_error(cmd->args[1], "numeric argument required"), 2);
+	return (code);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_source.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 18:52:09 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/17 18:52:09 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "output.h"
+#include "input.h"
+#include "list.h"
+#include "script.h"
+#include "global.h"
+#include <sys/stat.h>
+
+// 캐시에 있으면 원본을 복사만 함 (open/read 없이, 줄 캐시 덕에 렉싱/파싱도 생략)
+// 없으면 스크립트처럼 읽고 원본을 캐시에 남김
+static int	source_load(t_shell *shell, char *path, t_script *sc)
+{
+	struct stat	st;
+	t_src_cache	*node;
+	char		*copy;
+
+	if (stat(path, &st) == -1)
+		return (0);
+	node = find_src_cache(&shell->src_cache, path, st.st_mtim, st.st_size);
+	if (node)
+		return (script_from_buffer(sc, node->data, node->size));
+	if (!script_open(sc, path))
+		return (0);
+	if (sc->len != (size_t)st.st_size || sc->len > SRC_CACHE_MAX_BODY)
+		return (1);
+	copy = malloc(sc->len + 1);
+	if (!copy)
+		return (1);
+	ft_memcpy(copy, sc->data, sc->len);
+	copy[sc->len] = '\0';
+	node = create_src_cache(path, st.st_mtim, copy, st.st_size);
+	if (!node)
+		free(copy);
+	else
+		push_src_cache(&shell->src_cache, node);
+	return (1);
+}
+
+// 파일 내용을 현재 셸에서 한 줄씩 실행 (바깥 스크립트는 끝나면 되돌림)
+// 안에서는 마지막 명령이어도 exec으로 셸을 바꾸지 않음 (source_depth)
+// return이 나오면 남은 줄은 읽지 않음
+static int	source_lines(t_shell *shell, t_script *sc)
+{
+	t_prompt	prompt;
+	t_script	*outer;
+
+	ft_memset(&prompt, 0, sizeof(t_prompt));
+	prompt.envp_lst = shell->envp_list;
+	prompt.shell = shell;
+	outer = shell->script;
+	shell->script = sc;
+	shell->source_depth++;
+	g_exit_status = 0;
+	while (!shell->exit_flag && !shell->returning && input_process(&prompt))
+		run_line(shell, &prompt);
+	shell->returning = 0;
+	clear_token_list(&prompt.token_lst);
+	clear_hd_list(&prompt.hd_lst);
+	shell->source_depth--;
+	shell->script = outer;
+	return (g_exit_status);
+}
+
+// 파일 이름 뒤에 인자가 있으면 그동안만 $1부터 바꿈 ($0은 그대로)
+static int	source_params(t_shell *shell, t_cmd *cmd)
+{
+	char	**params;
+	int		count;
+
+	count = cmd->argc - 2;
+	params = malloc(sizeof(char *) * (count + 2));
+	if (!params)
+		return (0);
+	params[0] = shell->params[0];
+	ft_memcpy(params + 1, cmd->args + 2, sizeof(char *) * (count + 1));
+	shell->params = params;
+	shell->param_count = count;
+	return (1);
+}
+
+// source file [args...], . file [args...]
+// fork 없이 실행하므로 export, cd, 변수 값이 그대로 현재 셸에 남음
+int	ft_source(t_cmd *cmd, t_shell *shell)
+{
+	t_script	sc;
+	char		**outer_params;
+	int			outer_count;
+	int			status;
+
+	if (!cmd->args[1])
+		return (print_error(cmd->args[0], "filename argument required"), 2);
+	if (!source_load(shell, cmd->args[1], &sc))
+		return (print_error(cmd->args[1], strerror(errno)), FAILURE);
+	outer_params = shell->params;
+	outer_count = shell->param_count;
+	status = FAILURE;
+	if (!cmd->args[2] || source_params(shell, cmd))
+		status = source_lines(shell, &sc);
+	script_close(&sc);
+	if (shell->params != outer_params)
+		free(shell->params);
+	shell->params = outer_params;
+	shell->param_count = outer_count;
+	return (status);
+}
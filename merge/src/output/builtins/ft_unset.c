@@ -11,8 +11,10 @@
 /* ************************************************************************** */
 
 #include "builtins.h"
+#include "list.h"
+#include "expand.h"
 
-static void	remove_env_node(t_envp **envp_list, char *key)
+void	remove_env_node(t_envp **envp_list, char *key)
 {
 	t_envp	*current;
 	t_envp	*prev;
@@ -41,6 +43,27 @@ static void	remove_env_node(t_envp **envp_list, char *key)
 	}
 }
 
+// unset 'a[k]'는 원소 하나만 지움, 첨자는 ${a[k]}와 같게 확장
+static void	unset_element(t_shell *shell, char *arg, char *open)
+{
+	t_array	*arr;
+	char	*close;
+	char	*key;
+	size_t	i;
+
+	arr = find_array(shell, arg, open - arg);
+	close = ft_strchr(open, ']');
+	if (!arr || !close)
+		return ;
+	key = brace_word(open + 1, close - open - 1, shell->envp_list);
+	if (key && arr->assoc)
+		assoc_unset(arr, key);
+	else if (key && subscript_index(arr, key, shell->envp_list, &i))
+		array_unset(arr, i);
+	free(key);
+}
+
+// 배열 이름이면 배열째 지움
 int	ft_unset(t_cmd *cmd, t_shell *shell)
 {
 	int	i;
@@ -52,8 +75,15 @@ int	ft_unset(t_cmd *cmd, t_shell *shell)
 	i = 1;
 	while (cmd->args[i])
 	{
-		remove_env_node(&shell->envp_list, cmd->args[i]);
+		if (ft_strchr(cmd->args[i], '['))
+			unset_element(shell, cmd->args[i], ft_strchr(cmd->args[i], '['));
+		else
+		{
+			remove_env_node(&shell->envp_list, cmd->args[i]);
+			remove_array(shell, cmd->args[i]);
+		}
 		i++;
 	}
+	update_env_array(shell);
 	return (SUCCESS);
 }
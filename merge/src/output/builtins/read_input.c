@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_input.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:05:18 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 17:05:18 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include <sys/stat.h>
+
+// 글자 하나를 줄에 넣음, 구분자면 1, 메모리 오류면 -1
+// -r이 아니면 \ 다음 글자는 IFS로 나누지 않고, \+개행은 줄 이어짐이라 둘 다 버림
+static int	take(t_rd *rd, char c)
+{
+	char	mark;
+
+	mark = MASK_UNQUOTED;
+	if (rd->escaped)
+	{
+		rd->escaped = 0;
+		if (c == '\n')
+			return (0);
+		mark = MASK_QUOTED;
+	}
+	else if (!rd->raw && c == '\\')
+		return (rd->escaped = 1, 0);
+	else if (c == rd->delim)
+		return (1);
+	if (c == '\0')
+		return (0);
+	if (!sbuf_addc(&rd->val, c) || !sbuf_addc(&rd->mask, mark))
+		return (-1);
+	return (0);
+}
+
+// 일반 파일과 memfd(heredoc, here-string)는 READ_BLOCK씩 읽고
+// 구분자 뒤로 더 읽은 만큼 lseek으로 되돌려서 다음 명령이 그 자리부터 읽게 함
+static int	read_block(t_rd *rd, int fd)
+{
+	char	buf[READ_BLOCK];
+	ssize_t	n;
+	ssize_t	i;
+	int		ret;
+
+	ret = 0;
+	while (ret == 0)
+	{
+		n = read(fd, buf, READ_BLOCK);
+		if (n <= 0)
+			return (-(n < 0));
+		i = 0;
+		while (ret == 0 && i < n)
+			ret = take(rd, buf[i++]);
+		if (ret == 1 && i < n && lseek(fd, i - n, SEEK_CUR) == -1)
+			return (-1);
+	}
+	return (ret);
+}
+
+// 파이프와 tty는 되돌릴 수 없으므로 한 글자씩 (구분자 뒤는 다음 명령의 몫)
+static int	read_byte(t_rd *rd, int fd)
+{
+	char	c;
+	ssize_t	n;
+	int		ret;
+
+	ret = 0;
+	while (ret == 0)
+	{
+		n = read(fd, &c, 1);
+		if (n <= 0)
+			return (-(n < 0));
+		ret = take(rd, c);
+	}
+	return (ret);
+}
+
+// 구분자까지 읽었으면 1, 그 전에 EOF면 0, 오류면 -1
+int	read_line(t_rd *rd, int fd)
+{
+	struct stat	st;
+
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+		return (read_block(rd, fd));
+	return (read_byte(rd, fd));
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_split.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:21:47 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/18 17:21:47 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "split_word.h"
+
+// 마지막 변수는 남은 줄 전체 (끝의 IFS 공백은 버림)
+// 남은 게 필드 하나와 그 뒤 구분자뿐이면 필드만 (a:b: 에서 b)
+static char	*rest_field(t_token *tok, const char *ifs, t_field *f)
+{
+	t_field	probe;
+	size_t	start;
+	size_t	end;
+
+	probe = *f;
+	if (!next_field(tok, ifs, &probe))
+		return (ft_strdup(""));
+	start = probe.start;
+	end = probe.end;
+	if (!next_field(tok, ifs, &probe))
+		return (ft_my_strndup(tok->value + start, end - start));
+	end = ft_strlen(tok->value);
+	while (end > start && is_ifs_delim(tok, end - 1, ifs)
+		&& ft_strchr(" \t\n", tok->value[end - 1]))
+		end--;
+	return (ft_my_strndup(tok->value + start, end - start));
+}
+
+// 이름마다 IFS 필드 하나씩, 모자라면 빈 값, 이름이 없으면 REPLY에 줄 그대로
+// \로 escape된 글자는 mask가 MASK_QUOTED라 구분자가 되지 않음
+int	read_assign(t_rd *rd, char **names, t_shell *shell)
+{
+	t_token		tok;
+	t_field		f;
+	const char	*ifs;
+	char		*value;
+	int			ok;
+
+	tok.value = rd->val.data;
+	tok.mask = rd->mask.data;
+	ifs = get_ifs(shell->envp_list);
+	f.pos = 0;
+	ok = (*names || set_env_variable(shell, "REPLY", tok.value) == SUCCESS);
+	while (ok && *names)
+	{
+		if (!names[1])
+			value = rest_field(&tok, ifs, &f);
+		else if (next_field(&tok, ifs, &f))
+			value = ft_my_strndup(tok.value + f.start,
+					f.end - f.start);
+		else
+			value = ft_strdup("");
+		ok = (value && set_env_variable(shell, *names++, value) == SUCCESS);
+		free(value);
+	}
+	update_env_array(shell);
+	return (ok);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   capture.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 14:40:27 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/15 14:40:27 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "output.h"
+#include "input.h"
+#include "list.h"
+#include "global.h"
+#include "ast.h"
+#include <sys/stat.h>
+
+//$(< file): cat을 fork하지 않고 직접 읽음
+//일반 파일이면 크기만큼 미리 잡아서 read 한번에 끝남
+static int	capture_file(t_redir *redir, t_sbuf *out)
+{
+	struct stat	st;
+	int			fd;
+	int			ret;
+
+	if (redir->flag)
+		return (FAILURE);
+	fd = open(redir->filename, O_RDONLY);
+	if (fd < 0)
+	{
+		print_error(redir->filename, strerror(errno));
+		return (FAILURE);
+	}
+	ret = 1;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+		ret = sbuf_reserve(out, st.st_size + 1);
+	if (ret)
+		ret = read_all(fd, out);
+	close(fd);
+	if (!ret)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+//자식에서 파이프라인(복합 명령이면 트리)을 실행하고 그 stdout을 파이프로 끝까지 읽음
+//fork 전에 stdout을 비워야 부모의 버퍼가 자식 출력에 섞이지 않음
+//자식의 exit는 "exit"를 찍지 않음, 돌려주는 값은 자식의 종료 상태
+static int	capture_fork(t_pipeline *pl, t_prompt *prompt, t_sbuf *out)
+{
+	int		fds[2];
+	pid_t	pid;
+	int		status;
+
+	if (pipe(fds) == -1)
+		return (perror("pipe"), FAILURE);
+	fflush(stdout);
+	pid = fork_process();
+	if (pid == 0)
+	{
+		prompt->shell->in_subst = 1;
+		close(fds[READ_END]);
+		if (dup2(fds[WRITE_END], STDOUT_FILENO) == -1)
+			exit(1);
+		close(fds[WRITE_END]);
+		if (prompt->ast)
+			exit(execute_ast(prompt->ast, prompt->hd_lst, prompt->shell));
+		execute_pipeline(pl, prompt->shell);
+		exit(prompt->shell->last_exit_status);
+	}
+	close(fds[WRITE_END]);
+	if (pid != -1)
+		read_all(fds[READ_END], out);
+	close(fds[READ_END]);
+	if (pid == -1 || waitpid(pid, &status, 0) == -1)
+		return (FAILURE);
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (WEXITSTATUS(status));
+}
+
+//echo/pwd/env 하나뿐이면 (같은 이름의 함수가 없을 때) fork 없이 out에 바로
+//$(< file)은 파일을 직접 읽음
+//나머지는 fork해서 파이프로 받아옴, 어느 쪽이든 종료 상태를 돌려줌
+static int	capture_pipeline(t_pipeline *pl, t_prompt *prompt, t_sbuf *out)
+{
+	t_cmd	*cmd;
+
+	if (prompt->ast)
+		return (capture_fork(NULL, prompt, out));
+	cmd = &pl->cmds[0];
+	if (pl->cmd_count == 1 && cmd->argc == 0 && cmd->redir_count == 1
+		&& cmd->redirs[0].type == T_REDIR_IN && cmd->redirs[0].io == 0)
+		return (capture_file(&cmd->redirs[0], out));
+	if (pl->cmd_count == 1 && cmd->redir_count == 0 && cmd->argc > 0
+		&& is_pure_builtin(cmd->args[0])
+		&& !find_function(prompt->shell, cmd->args[0]))
+		return (capture_builtin(cmd, prompt->shell, out));
+	return (capture_fork(pl, prompt, out));
+}
+
+//$( body )의 출력, 끝의 개행은 모두 지움
+//body는 바깥 줄의 캐시를 건드리지 않도록 캐시 없이 처리
+//종료 상태는 subst_status와 $?에 남김 (x=$(false); echo $? -> 1)
+//메모리 오류면 NULL, 실행이 실패하면 그때까지의 출력
+char	*command_output(char *body)
+{
+	t_prompt	prompt;
+	t_pipeline	*pl;
+	t_sbuf		out;
+	int			status;
+	t_procsub	*mark;
+
+	if (!sbuf_init(&out, 0))
+		return (NULL);
+	ft_memset(&prompt, 0, sizeof(t_prompt));
+	prompt.input = body;
+	prompt.shell = current_shell(NULL);
+	mark = prompt.shell->procsubs;
+	pl = NULL;
+	status = !line_process(&prompt, 0) || !prompt.token_lst;
+	if (!status && !prompt.ast && prompt.token_lst->type != T_END)
+		pl = parse_tokens(&prompt);
+	if (pl || (prompt.ast && !status))
+		status = capture_pipeline(pl, &prompt, &out);
+	prompt.shell->subst_status = status;
+	g_exit_status = status;
+	reap_procsubs(prompt.shell, mark);
+	free_pipeline(pl);
+	free_ast(prompt.ast);
+	clear_token_list(&prompt.token_lst);
+	clear_hd_list(&prompt.hd_lst);
+	while (out.len && out.data[out.len - 1] == '\n')
+		out.data[--out.len] = '\0';
+	return (out.data);
+}
@@ -30,6 +30,10 @@ int	execute_builtin(t_cmd *cmd, t_shell *shell)
 	if (!cmd || !cmd->args || !cmd->args[0])
 		return (FAILURE);
 	command = cmd->args[0];
+	if (ft_strcmp(command, ":") == 0 || ft_strcmp(command, "true") == 0)
+		return (SUCCESS);
+	if (ft_strcmp(command, "false") == 0)
+		return (FAILURE);
 	if (ft_strcmp(command, "echo") == 0)
 		return (ft_echo(cmd));
 	if (ft_strcmp(command, "cd") == 0)
@@ -44,6 +48,33 @@ int	execute_builtin(t_cmd *cmd, t_shell *shell)
 		return (ft_env(shell));
 	if (ft_strcmp(command, "exit") == 0)
 		return (ft_exit(cmd, shell));
+	if (ft_strcmp(command, "exec") == 0)
+		return (ft_exec(cmd, shell));
+	if (ft_strcmp(command, "source") == 0 || ft_strcmp(command, ".") == 0)
+		return (ft_source(cmd, shell));
+	if (ft_strcmp(command, "break") == 0 || ft_strcmp(command, "continue") == 0)
+		return (ft_break(cmd, shell));
+	if (ft_strcmp(command, "return") == 0)
+		return (ft_return(cmd, shell));
+	if (ft_strcmp(command, "read") == 0)
+		return (ft_read(cmd, shell));
+	if (ft_strcmp(command, "declare") == 0)
+		return (ft_declare(cmd, shell));
+	if (ft_strcmp(command, "mapfile") == 0
+		|| ft_strcmp(command, "readarray") == 0)
+		return (ft_mapfile(cmd, shell));
+	return (FAILURE);
+}
+
+//셸 상태를 안바꾸는 빌트인을 fork 없이 돌려서 출력을 out에 모음
+int	capture_builtin(t_cmd *cmd, t_shell *shell, t_sbuf *out)
+{
+	if (ft_strcmp(cmd->args[0], "echo") == 0)
+		return (echo_output(cmd, out));
+	if (ft_strcmp(cmd->args[0], "pwd") == 0)
+		return (pwd_output(out));
+	if (ft_strcmp(cmd->args[0], "env") == 0)
+		return (env_output(shell, out));
 	return (FAILURE);
 }
 
@@ -59,6 +90,9 @@ int	execute_external(t_cmd *cmd, t_shell *shell)
 		print_error(cmd->args[0], "command not found");
 		return (127);
 	}
+	if (!ready_env_array(shell))
+		return (free(executable_path), perror("malloc fail : execute_external"),
+			126);
 	if (execve(executable_path, cmd->args, shell->env_array) == -1)
 	{
 		print_error(cmd->args[0], strerror(errno));
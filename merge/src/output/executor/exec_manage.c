@@ -51,9 +51,9 @@ void	setup_child_process(t_cmd *cmd, int *pipe_fds, \
 							int cmd_index, int cmd_count)
 {
 	(void)cmd;
-	// stdin 설정: heredoc이 없고 파이프가 있는 경우에만 처리
-	// heredoc은 setup_redirections에서 처리
-	if (!(cmd->hd && cmd->hd != -1) && cmd_index > 0)
+	// stdin 설정: 파이프가 있으면 먼저 연결
+	// heredoc과 '<'는 setup_redirections에서 순서대로 덮어씀
+	if (cmd_index > 0)
 	{
 		if (dup2(pipe_fds[(cmd_index - 1) * 2 + READ_END], STDIN_FILENO) == -1)
 		{
@@ -111,16 +111,3 @@ void	close_all_pipes(int *pipe_fds, int pipe_count)
 		i++;
 	}
 }
-
-int	count_commands(t_cmd *cmd)
-{
-	int	count;
-
-	count = 0;
-	while (cmd)
-	{
-		count++;
-		cmd = cmd->next;
-	}
-	return (count);
-}
@@ -11,6 +11,7 @@
 /* ************************************************************************** */
 
 #include "executor.h"
+#include "ast.h"
 
 static int	create_pipes(int **pipe_fds, int cmd_count)
 {
@@ -65,6 +66,7 @@ static int	fork_and_execute(t_cmd *cmd, t_shell *shell, int *pipe_fds,
 {
 	pid_t	pid;
 	int		exit_code;
+	t_node	*def;
 
 	pid = fork_process(); 
 	if (pid == -1)
@@ -81,10 +83,13 @@ static int	fork_and_execute(t_cmd *cmd, t_shell *shell, int *pipe_fds,
 		
 		// 3. 명령어 유효성 검사
 		if (!cmd || !cmd->args || !cmd->args[0])
-			exit(1);
+			exit(shell->subst_status);
 		
-		// 4. 명령어 실행
-		if (is_builtin_command(cmd->args[0]))
+		// 4. 명령어 실행 (함수, 빌트인, 외부 명령 순)
+		def = find_function(shell, cmd->args[0]);
+		if (def)
+			exit_code = call_function(def, cmd, shell);
+		else if (is_builtin_command(cmd->args[0]))
 			exit_code = execute_builtin(cmd, shell);
 		else
 			exit_code = execute_external(cmd, shell);
@@ -110,70 +115,57 @@ static void	cleanup_resources(int *pipe_fds, pid_t *pids, int cmd_count)
 		free(pids);
 }
 
+// 단일 빌트인 명령어는 현재 쉘에서 직접 실행
+// 리다이렉션이 바꾼 fd는 끝나면 되돌림 (실패해도 앞에서 바꾼 것까지)
+// 인자 없는 exec은 리다이렉션을 셸에 남기는 게 목적이라 되돌리지 않음
+// 빌트인의 종료 코드는 외부 명령처럼 last_exit_status로만 전달
 static int	handle_single_builtin(t_cmd *commands, t_shell *shell)
 {
 	int	result;
-	int	saved_stdout;
-	int	saved_stdin;
 
-	// 리다이렉션이 있는 경우를 위해 원본 파일 디스크립터 저장
-	saved_stdout = -1;
-	saved_stdin = -1;
-	
-	// 리다이렉션 처리
-	if (commands->output_file && commands->output_file->filename && 
-		ft_strcmp(commands->output_file->filename, "NULL") != 0)
-	{
-		saved_stdout = dup(STDOUT_FILENO);
-	}
-	if ((commands->input_file && commands->input_file->filename && 
-		ft_strcmp(commands->input_file->filename, "NULL") != 0) ||
-		(commands->hd && commands->hd != -1))
-	{
-		saved_stdin = dup(STDIN_FILENO);
-	}
-	
+	save_redirections(commands);
 	if (setup_redirections(commands, 0, 1) == FAILURE)
 	{
-		if (saved_stdout != -1) close(saved_stdout);
-		if (saved_stdin != -1) close(saved_stdin);
+		restore_redirections(commands, 0);
+		shell->last_exit_status = 1;
 		return (FAILURE);
 	}
-
-	// 단일 빌트인 명령어는 현재 쉘에서 직접 실행
+	// exit은 종료 코드를 last_exit_status에 직접 넣어둠
 	result = execute_builtin(commands, shell);
-	shell->last_exit_status = result;
-	
-	// 리다이렉션 복구
-	if (saved_stdout != -1)
-	{
-		dup2(saved_stdout, STDOUT_FILENO);
-		close(saved_stdout);
-	}
-	if (saved_stdin != -1)
-	{
-		dup2(saved_stdin, STDIN_FILENO);
-		close(saved_stdin);
-	}
-	
-	return (result);
+	if (!shell->exit_flag)
+		shell->last_exit_status = result;
+	restore_redirections(commands, ft_strcmp(commands->args[0], "exec") == 0
+		&& !commands->args[1]);
+	return (SUCCESS);
 }
 
-int	execute_pipeline(t_cmd *commands, t_shell *shell)
+int	execute_pipeline(t_pipeline *pl, t_shell *shell)
 {
 	int		*pipe_fds;
 	pid_t	*pids;
-	t_cmd	*current;
 	int		cmd_count;
 	int		i;
+	t_node	*def;
 
-	if (!commands || !shell)
+	if (!pl || !shell)
 		return (FAILURE);
 	
-	cmd_count = count_commands(commands);
+	cmd_count = pl->cmd_count;
 
-	if (cmd_count == 1 && commands->args && is_builtin_command(commands->args[0]))
-		return (handle_single_builtin(commands, shell));
+	// 단일 함수 호출도 현재 쉘에서 (빌트인보다 먼저)
+	def = NULL;
+	if (cmd_count == 1 && pl->cmds[0].args)
+		def = find_function(shell, pl->cmds[0].args[0]);
+	if (def)
+		return (run_function(def, &pl->cmds[0], shell));
+	if (cmd_count == 1 && pl->cmds[0].args
+		&& is_builtin_command(pl->cmds[0].args[0]))
+		return (handle_single_builtin(&pl->cmds[0], shell));
+	if (execute_tail(pl, shell))
+		return (SUCCESS);
+	// 자식마다 만들지 않도록 환경 배열은 fork 전에 부모에서 (다음에도 재사용)
+	if (!ready_env_array(shell))
+		return (FAILURE);
 	
 	// 파이프 생성
 	if (create_pipes(&pipe_fds, cmd_count) == FAILURE)
@@ -192,11 +184,10 @@ int	execute_pipeline(t_cmd *commands, t_shell *shell)
 	}
 	
 	// 각 명령어를 포크하여 실행
-	current = commands;
 	i = 0;
-	while (current && i < cmd_count)
+	while (i < cmd_count)
 	{
-		pids[i] = fork_and_execute(current, shell, pipe_fds, i, cmd_count);
+		pids[i] = fork_and_execute(&pl->cmds[i], shell, pipe_fds, i, cmd_count);
 		if (pids[i] == -1)
 		{
 			// 포크 실패 시 이미 생성된 자식 프로세스들을 종료
@@ -205,7 +196,6 @@ int	execute_pipeline(t_cmd *commands, t_shell *shell)
 			cleanup_resources(pipe_fds, pids, cmd_count);
 			return (FAILURE);
 		}
-		current = current->next;
 		i++;
 	}
 	// 부모 프로세스에서 모든 파이프 닫기
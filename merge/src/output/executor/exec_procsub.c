@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_procsub.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:02:54 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/17 11:02:54 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "executor.h"
+#include "ast.h"
+
+static int	push_procsub(t_shell *shell, pid_t pid, int fd)
+{
+	t_procsub	*node;
+
+	node = malloc(sizeof(t_procsub));
+	if (!node)
+		return (0);
+	node->pid = pid;
+	node->fd = fd;
+	node->next = shell->procsubs;
+	shell->procsubs = node;
+	return (1);
+}
+
+// 자식: 파이프 한쪽을 stdin 또는 stdout에 붙이고 파이프라인(또는 트리) 실행
+static void	run_procsub(t_prompt *prompt, t_pipeline *pl, int *fds,
+		int child_end)
+{
+	t_shell	*shell;
+	int		target;
+
+	shell = prompt->shell;
+	close(fds[1 - child_end]);
+	target = STDOUT_FILENO;
+	if (child_end == READ_END)
+		target = STDIN_FILENO;
+	if (dup2(fds[child_end], target) == -1)
+		exit(1);
+	close(fds[child_end]);
+	if (prompt->ast && prompt->token_lst)
+		exit(execute_ast(prompt->ast, prompt->hd_lst, shell));
+	if (pl)
+		execute_pipeline(pl, shell);
+	exit(shell->last_exit_status);
+}
+
+// <( )는 자식의 stdout을, >( )는 자식의 stdin을 파이프에 연결
+// 부모 쪽 끝은 명령이 /dev/fd/N 으로 열 수 있게 열어둔 채 기록해 두고
+// 명령이 끝나면 reap_procsubs가 닫고 기다림
+int	start_procsub(t_prompt *prompt, t_pipeline *pl, int to_cmd)
+{
+	int		fds[2];
+	pid_t	pid;
+	int		child_end;
+
+	if (pipe(fds) == -1)
+		return (perror("pipe"), -1);
+	child_end = WRITE_END;
+	if (to_cmd)
+		child_end = READ_END;
+	fflush(stdout);
+	pid = fork_process();
+	if (pid == 0)
+		run_procsub(prompt, pl, fds, child_end);
+	close(fds[child_end]);
+	if (pid == -1 || !push_procsub(prompt->shell, pid, fds[1 - child_end]))
+	{
+		close(fds[1 - child_end]);
+		if (pid != -1)
+			waitpid(pid, NULL, 0);
+		return (-1);
+	}
+	return (fds[1 - child_end]);
+}
+
+static int	count_procsubs(t_procsub *curr, t_procsub *mark)
+{
+	int	count;
+
+	count = 0;
+	while (curr && curr != mark)
+	{
+		count++;
+		curr = curr->next;
+	}
+	return (count);
+}
+
+// mark 위에 쌓인 프로세스 치환을 정리 (종료 코드는 버림)
+// 부모 쪽 끝을 먼저 모두 닫아야 >( ) 쪽 자식이 EOF를 받고 끝남
+void	reap_procsubs(t_shell *shell, t_procsub *mark)
+{
+	t_procsub	*curr;
+	pid_t		*pids;
+	int			count;
+
+	count = count_procsubs(shell->procsubs, mark);
+	if (count == 0)
+		return ;
+	pids = malloc(sizeof(pid_t) * count);
+	count = 0;
+	while (shell->procsubs && shell->procsubs != mark)
+	{
+		curr = shell->procsubs;
+		shell->procsubs = curr->next;
+		close(curr->fd);
+		if (pids)
+			pids[count++] = curr->pid;
+		else
+			waitpid(curr->pid, NULL, 0);
+		free(curr);
+	}
+	if (pids)
+		wait_for_children(pids, count);
+	free(pids);
+}
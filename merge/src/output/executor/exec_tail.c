@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_tail.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 14:31:47 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/17 14:31:47 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "executor.h"
+#include "script.h"
+#include "sigft.h"
+#include "ast.h"
+
+// -c/스크립트의 마지막 단순 외부 명령인지
+// 남은 입력, source 중인 파일, 기다려야 할 프로세스 치환이 있으면 안됨 (trap, job control은 없음)
+// 복합 명령 안은 뒤에 돌 명령이 트리에 남아 있을 수 있어서 안됨
+// 같은 이름의 함수가 있으면 그게 먼저라 안됨
+static int	can_tail_exec(t_pipeline *pl, t_shell *shell)
+{
+	t_cmd	*cmd;
+
+	if (!shell->script || shell->source_depth || shell->ast_depth
+		|| shell->procsubs || pl->cmd_count != 1)
+		return (0);
+	cmd = &pl->cmds[0];
+	if (!cmd->args || !cmd->args[0] || is_builtin_command(cmd->args[0])
+		|| find_function(shell, cmd->args[0]))
+		return (0);
+	return (script_at_end(shell->script));
+}
+
+// fork/wait 없이 셸 자신을 마지막 명령으로 바꿈
+// 해당 없으면 0, exec까지 못 갔으면 종료 코드를 넣고 1
+// exec 뒤에는 main으로 안 돌아오므로 캐시 통계는 리다이렉션 전에 미리 냄
+int	execute_tail(t_pipeline *pl, t_shell *shell)
+{
+	if (!can_tail_exec(pl, shell))
+		return (0);
+	fflush(stdout);
+	report_stats(shell);
+	setup_signals_child();
+	if (setup_redirections(&pl->cmds[0], 0, 1) == FAILURE)
+		shell->last_exit_status = 1;
+	else
+		shell->last_exit_status = execute_external(&pl->cmds[0], shell);
+	return (1);
+}
@@ -26,19 +26,27 @@
 # define READ_END 0
 # define WRITE_END 1
 
-int		execute_pipeline(t_cmd *commands, t_shell *shell);
+int		execute_pipeline(t_pipeline *pl, t_shell *shell);
 int		execute_command(t_cmd *cmd, t_shell *shell);
 int		execute_builtin(t_cmd *cmd, t_shell *shell);
 int		execute_external(t_cmd *cmd, t_shell *shell);
+int		execute_tail(t_pipeline *pl, t_shell *shell);
+int		capture_builtin(t_cmd *cmd, t_shell *shell, t_sbuf *out);
 pid_t	fork_process(void);
 int		wait_for_children(pid_t *pids, int count);
 void	setup_child_process(t_cmd *cmd, int *pipe_fds, int cmd_index, int cmd_count);
 void	setup_parent_process(int *pipe_fds, int cmd_index, int cmd_count);
 void	close_all_pipes(int *pipe_fds, int pipe_count);
-int		count_commands(t_cmd *cmd);
 int		setup_redirections(t_cmd *cmd, int cmd_index, int cmd_count);
 int		open_input_file(char *filename);
 int		open_output_file(char *filename, int append_mode);
+int		open_herestring(const char *s);
+int		attach_fd(int fd, int target);
+int		apply_dup(t_redir *redir);
+void	save_redirections(t_cmd *cmd);
+void	restore_redirections(t_cmd *cmd, int keep);
+int		start_procsub(t_prompt *prompt, t_pipeline *pl, int to_cmd);
+void	reap_procsubs(t_shell *shell, t_procsub *mark);
 //int		setup_heredoc(char *delimiter);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_fd.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 16:02:33 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/17 16:02:33 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "executor.h"
+
+// fd를 대상 번호로 복제, 대상이 잘못된 번호면 bash처럼 Bad file descriptor
+int	attach_fd(int fd, int target)
+{
+	char	*num;
+
+	if (dup2(fd, target) != -1)
+		return (SUCCESS);
+	num = ft_itoa(target);
+	if (num)
+		print_error(num, strerror(errno));
+	free(num);
+	return (FAILURE);
+}
+
+// N>&M, N<&M: M을 N으로 복제 / N>&-: N을 닫음
+int	apply_dup(t_redir *redir)
+{
+	char	*s;
+	int		src;
+
+	s = redir->filename;
+	if (ft_strcmp(s, "-") == 0)
+		return (close(redir->io), SUCCESS);
+	src = 0;
+	while (ft_isdigit(*s) && src < SHELL_FD_BASE * 100)
+		src = src * 10 + *s++ - '0';
+	if (*s || s == redir->filename)
+		return (print_error(redir->filename, "ambiguous redirect"), FAILURE);
+	if (dup2(src, redir->io) == -1)
+		return (print_error(redir->filename, strerror(errno)), FAILURE);
+	return (SUCCESS);
+}
+
+// 셸 안에서 도는 빌트인은 리다이렉션이 바꿀 fd를 먼저 높은 번호로 복사해 둠
+// 원래 닫혀 있던 fd면 saved가 -1 (되돌릴 때 닫기만 함)
+void	save_redirections(t_cmd *cmd)
+{
+	int	i;
+
+	i = -1;
+	while (++i < cmd->redir_count)
+		cmd->redirs[i].saved = fcntl(cmd->redirs[i].io, F_DUPFD_CLOEXEC,
+				SHELL_FD_BASE);
+}
+
+// 나중 것부터 되돌림
+// keep이면 (단독 exec) 바뀐 fd를 셸에 그대로 두고 복사본만 닫음
+void	restore_redirections(t_cmd *cmd, int keep)
+{
+	t_redir	*redir;
+	int		i;
+
+	i = cmd->redir_count;
+	while (i-- > 0)
+	{
+		redir = &cmd->redirs[i];
+		if (!keep && redir->saved >= 0)
+			dup2(redir->saved, redir->io);
+		else if (!keep)
+			close(redir->io);
+		if (redir->saved >= 0)
+			close(redir->saved);
+		redir->saved = -1;
+	}
+}
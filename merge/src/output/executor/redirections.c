@@ -11,75 +11,55 @@
 /* ************************************************************************** */
 
 #include "executor.h"
+#include "herdoc.h"
+#include <limits.h>
 #include <stdio.h>
 
+// heredoc은 hd_lst 소유, here-string은 파이프라인 소유라 여기서 닫지 않음
+// heredoc은 memfd 기반이라 처음 위치로 되감은 뒤 대상 fd(기본 stdin)로 연결
+// 연 파일이 마침 대상 번호로 열렸으면 (닫혀 있던 fd) 그대로 씀
+static int	apply_redirection(t_redir *redir)
+{
+	int	fd;
+
+	if (redir->type == T_HEREDOC && lseek(redir->fd, 0, SEEK_SET) == -1)
+		return (FAILURE);
+	if (redir->type == T_HEREDOC || redir->type == T_HERESTRING)
+		return (attach_fd(redir->fd, redir->io));
+	if (redir->flag == 1)
+		return (print_error(redir->filename, "ambiguous redirect"), FAILURE);
+	if (redir->type == T_DUP_IN || redir->type == T_DUP_OUT)
+		return (apply_dup(redir));
+	if (redir->type == T_REDIR_IN)
+		fd = open_input_file(redir->filename);
+	else
+		fd = open_output_file(redir->filename, redir->type == T_APPEND);
+	if (fd == -1)
+		return (FAILURE);
+	if (fd == redir->io)
+		return (SUCCESS);
+	if (attach_fd(fd, redir->io) == FAILURE)
+		return (close(fd), FAILURE);
+	close(fd);
+	return (SUCCESS);
+}
+
+// 리다이렉션은 명령줄에 나온 순서대로 적용 - 같은 방향이면 나중 것이 이김
+// 파이프가 있는 중간 명령어에서는 여기서 파이프를 덮어씀
 int	setup_redirections(t_cmd *cmd, int cmd_index, int cmd_count)
 {
-	int	fd_in;
-	int	fd_out;
-	int	heredoc_fd;
-	t_filename *file;
+	int	i;
 
 	(void)cmd_index;
 	(void)cmd_count;
 	if (!cmd)
 		return (FAILURE);
-	fd_in = -1;
-	fd_out = -1;
-	heredoc_fd = -1;
-
-	// heredoc 처리 - fd는 나중에 닫기
-	if (cmd->hd && cmd->hd != -1)
+	i = -1;
+	while (++i < cmd->redir_count)
 	{
-		heredoc_fd = cmd->hd;
-		if (dup2(cmd->hd, STDIN_FILENO) == -1)
-			return (close(cmd->hd), FAILURE);
-	}
-	// 입력 리다이렉션 처리 (stdin)
-	if (cmd->input_file && cmd->input_file->filename && 
-		ft_strcmp(cmd->input_file->filename, "NULL") != 0)
-	{
-		if (cmd->input_file->flag == 1)
-			return (print_error(cmd->input_file->filename, "ambiguous redirect"), FAILURE);
-		fd_in = open_input_file(cmd->input_file->filename);
-		if (fd_in == -1)
-			return (FAILURE);
-		if (dup2(fd_in, STDIN_FILENO) == -1)
-		{
-			close(fd_in);
+		if (apply_redirection(&cmd->redirs[i]) == FAILURE)
 			return (FAILURE);
-		}
-		close(fd_in);
-	}
-	
-	// 출력 리다이렉션 처리 (stdout) - 파이프가 있는 중간 명령어에서는 출력 리다이렉션이 파이프를 덮어씀
-	if (cmd->output_file && cmd->output_file->filename && 
-		ft_strcmp(cmd->output_file->filename, "NULL") != 0)
-	{
-		file = cmd->output_file;
-		while (file)
-		{
-			if (file->flag == 1)
-				return (print_error(file->filename, "ambiguous redirect"), FAILURE);
-			fd_out = open_output_file(file->filename, file->append_mode);
-			if (fd_out == -1)
-				return (FAILURE);
-			if (file->next == NULL)
-			{
-				if (dup2(fd_out, STDOUT_FILENO) == -1)
-				{
-						close(fd_out);
-						return (FAILURE);
-				}
-				close(fd_out);
-			}
-			file = file->next;
-		}
 	}
-	// heredoc fd는 마지막에 닫기
-	if (heredoc_fd != -1)
-		close(heredoc_fd);
-		
 	return (SUCCESS);
 }
 
@@ -118,3 +98,30 @@ int	open_output_file(char *filename, int append_mode)
 	}
 	return (fd);
 }
+
+// <<< 단어와 끝의 개행을 담은 읽기용 fd (close-on-exec)
+// PIPE_BUF보다 짧으면 pipe에 바로 써둠 (용량 안이라 막히지 않음)
+// 길면 heredoc과 같은 memfd에 쓰고 처음으로 되감음
+int	open_herestring(const char *s)
+{
+	int		fds[2];
+	size_t	len;
+
+	len = ft_strlen(s);
+	if (len < PIPE_BUF && pipe(fds) == 0)
+	{
+		fds[READ_END] = move_fd_high(fds[READ_END]);
+		if (fds[READ_END] < 0 || !write_all(fds[WRITE_END], s, len)
+			|| !write_all(fds[WRITE_END], "\n", 1))
+			return (close(fds[READ_END]), close(fds[WRITE_END]), -1);
+		close(fds[WRITE_END]);
+		return (fds[READ_END]);
+	}
+	fds[0] = open_heredoc_fd();
+	if (fds[0] < 0)
+		return (-1);
+	if (!write_all(fds[0], s, len) || !write_all(fds[0], "\n", 1)
+		|| lseek(fds[0], 0, SEEK_SET) == -1)
+		return (close(fds[0]), -1);
+	return (fds[0]);
+}
@@ -139,5 +139,28 @@ int init_shell(t_shell *shell)
     shell->last_exit_status = 0;
     shell->exit_flag = 0;
     shell->signal_mode = SIG_INTERACTIVE;
+    shell->subst_status = 0;
+    shell->in_subst = 0;
+    shell->hd_cache = NULL;
+    shell->line_cache = NULL;
+    shell->arith_cache = NULL;
+    shell->pw_cache = NULL;
+    shell->env_gen = 0;
+    ft_memset(&shell->stats, 0, sizeof(t_stats));
+    shell->stats.enabled = (getenv("MINISHELL_STATS") != NULL);
+    shell->procsubs = NULL;
+    shell->script = NULL;
+    shell->params = NULL;
+    shell->param_count = 0;
+    shell->src_cache = NULL;
+    shell->source_depth = 0;
+    shell->ast_depth = 0;
+    shell->loop_depth = 0;
+    shell->loop_break = 0;
+    shell->loop_continue = 0;
+    shell->funcs = NULL;
+    shell->frame = NULL;
+    shell->returning = 0;
+    shell->arrays = NULL;
     return (SUCCESS);
 }
@@ -6,6 +6,13 @@
 # include "parser.h"
 # include "executor.h"
 
-int	output_process(t_shell *shell, t_prompt *prompt);
+int		output_process(t_shell *shell, t_prompt *prompt);
+void	run_line(t_shell *shell, t_prompt *prompt);
+
+//capture.c
+char	*command_output(char *body);
+
+//procsub.c
+char	*process_subst(char *body, int to_cmd);
 
 #endif
\ No newline at end of file
@@ -1,18 +1,55 @@
 #include "output.h"
 #include "print.h"
+#include "input.h"
+#include "list.h"
+#include "global.h"
+#include "ast.h"
 
 int	output_process(t_shell *shell, t_prompt *prompt)
 {
-	t_cmd	*cmd;
+	t_pipeline	*pl;
+	int			ret;
 
-	cmd = parse_tokens(prompt);
-	if (!cmd)
-		return (printf("Parsing failed\n"), FAILURE);
-	print_cmd_list(cmd);
+	if (prompt->ast)
+		return (execute_ast(prompt->ast, prompt->hd_lst, shell));
+	pl = prompt->pl;
+	prompt->pl = NULL;
+	if (!pl && prompt->token_lst->type == T_END)
+		return (shell->subst_status);
+	if (!pl)
+	{
+		pl = parse_tokens(prompt);
+		if (!pl)
+			return (reap_procsubs(shell, NULL),
+				printf("Parsing failed\n"), FAILURE);
+		remember_pipeline(prompt, pl);
+	}
+	print_pipeline(pl);
 	printf("Starting EXEC\n");
 	printf("==== DEBUG: Print Result ===\n");
-	if (execute_pipeline(cmd, shell) != SUCCESS)
+	ret = execute_pipeline(pl, shell);
+	reap_procsubs(shell, NULL);
+	free_pipeline(pl);
+	if (ret != SUCCESS)
         return (FAILURE);
-	free_commands(cmd);
 	return (shell->last_exit_status);
 }
+
+//한 줄을 실행하고 $?를 맞춰둠 (문법 오류로 토큰이 없으면 syntax_print가 넣은 2 유지)
+//실행하지 않는 줄도 확장 중에 띄운 <( ) >( ) 자식은 회수 (확장 오류로 버려진 줄 등)
+//스크립트 모드의 prompt->input은 스크립트 버퍼 안이라 free하지 않음
+void	run_line(t_shell *shell, t_prompt *prompt)
+{
+	if (prompt->token_lst || prompt->pl || prompt->ast)
+		g_exit_status = output_process(shell, prompt);
+	else
+		reap_procsubs(shell, NULL);
+	shell->last_exit_status = g_exit_status;
+	if (!shell->script)
+		free(prompt->input);
+	prompt->input = NULL;
+	free_ast(prompt->ast);
+	prompt->ast = NULL;
+	clear_token_list(&prompt->token_lst);
+	clear_hd_list(&prompt->hd_lst);
+}
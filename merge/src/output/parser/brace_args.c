@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_args.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/16 15:40:22 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/16 15:40:22 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "parser.h"
+#include "brace.h"
+
+// BRACE 토큰은 단어를 하나씩 만들어 바로 argv에 넣음
+// 중간 토큰 리스트 없이, 반복자가 쓰는 버퍼는 가장 긴 단어 하나 크기
+int	add_brace_arguments(t_cmd *cmd, t_token *token)
+{
+	t_brace_iter	it;
+	t_token			arg;
+	const char		*word;
+
+	if (brace_iter_init(&it, token->value) <= 0)
+		return (FAILURE);
+	ft_memset(&arg, 0, sizeof(t_token));
+	word = brace_iter_next(&it);
+	while (word)
+	{
+		arg.value = ft_strdup(word);
+		if (!arg.value || add_argument(cmd, &arg) == FAILURE)
+			break ;
+		word = brace_iter_next(&it);
+	}
+	brace_iter_free(&it);
+	if (word || it.err)
+	{
+		free(arg.value);
+		return (FAILURE);
+	}
+	return (SUCCESS);
+}
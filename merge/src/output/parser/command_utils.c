@@ -12,71 +12,56 @@
 
 #include "parser.h"
 
-t_cmd	*create_command(t_hd *hd_lst)
+void	init_command(t_cmd *cmd)
 {
-	t_cmd	*cmd;
-	t_hd	*last;
-
-	cmd = malloc(sizeof(t_cmd));
-	if (!cmd)
-		return (NULL);
 	cmd->args = NULL;
-	cmd->input_file = create_filename();
-	if (!cmd->input_file)
-		return (free(cmd), NULL);
-	cmd->output_file = create_filename();
-	if (!cmd->output_file)
-		return (free(cmd->input_file), free(cmd), NULL);
-	cmd->next = NULL;
-	last = hd_lst;
-	if (last)
-	{
-		while (last->next)
-			last = last->next;
-		cmd->hd = last->fd;
-	}
-	else
-		cmd->hd = -1;
-	return (cmd);
+	cmd->argc = 0;
+	cmd->arg_cap = 0;
+	cmd->redirs = NULL;
+	cmd->redir_count = 0;
 }
 
-static int	count_args(char **args)
-{
-	int	count;
-
-	if (!args)
-		return (0);
-	count = 0;
-	while (args[count])
-		count++;
-	return (count);
-}
-
-void add_argument(t_cmd *cmd, char *arg)
+// argv를 cap 칸(NULL 포함)으로 늘리고 기존 포인터만 옮김
+int	reserve_args(t_cmd *cmd, int cap)
 {
 	char	**new_args;
-	int	count;
-	int	i;
+	int		i;
 
-	if (!cmd || !arg)
-		return ;
-	count = count_args(cmd->args);
-	new_args = malloc(sizeof(char *) * (count + 2));
+	if (cap <= cmd->arg_cap)
+		return (SUCCESS);
+	new_args = malloc(sizeof(char *) * cap);
 	if (!new_args)
-		return ;
+		return (FAILURE);
 	i = -1;
-	while (++i < count)
+	while (++i < cmd->argc)
 		new_args[i] = cmd->args[i];
-	new_args[count] = malloc(ft_strlen(arg) + 1);
-	if (!new_args[count])
-	{
-		free(new_args);
-		return ;
-	}
-	ft_strcpy(new_args[count], arg);
-	new_args[count + 1] = NULL;
+	new_args[cmd->argc] = NULL;
 	free(cmd->args);
 	cmd->args = new_args;
+	cmd->arg_cap = cap;
+	return (SUCCESS);
+}
+
+// 토큰 문자열을 복사하지 않고 그대로 가져옴 (토큰 쪽은 NULL로 비움)
+// 용량이 차면 두배로 늘림 (인자 n개에 대해 amortized O(1))
+int	add_argument(t_cmd *cmd, t_token *token)
+{
+	int	cap;
+
+	if (!cmd || !token || !token->value)
+		return (FAILURE);
+	if (cmd->argc + 1 >= cmd->arg_cap)
+	{
+		cap = cmd->arg_cap * 2;
+		if (cap < ARGS_INIT_CAP)
+			cap = ARGS_INIT_CAP;
+		if (reserve_args(cmd, cap) == FAILURE)
+			return (FAILURE);
+	}
+	cmd->args[cmd->argc++] = token->value;
+	cmd->args[cmd->argc] = NULL;
+	token->value = NULL;
+	return (SUCCESS);
 }
 
 static void	free_args(char **args)
@@ -95,29 +80,27 @@ static void	free_args(char **args)
 	free(args);
 }
 
-void	free_commands(t_cmd *commands)
+// 문자열은 토큰에서 넘겨받은 것이라 따로 해제하고 here-string fd는 닫음
+// 파이프라인 자체는 한 블록이라 free 한 번으로 끝남
+void	free_pipeline(t_pipeline *pl)
 {
-	t_cmd	*current;
-	t_cmd	*next;
+	int	i;
+	int	j;
 
-	current = commands;
-	while (current)
+	if (!pl)
+		return ;
+	i = -1;
+	while (++i < pl->cmd_count)
 	{
-		next = current->next;
-		free_args(current->args);
-		if (current->input_file)
-		{
-			if (current->input_file->filename)
-				free(current->input_file->filename);
-			free(current->input_file);
-		}
-		if (current->output_file)
+		free_args(pl->cmds[i].args);
+		j = -1;
+		while (++j < pl->cmds[i].redir_count)
 		{
-			if (current->output_file->filename)
-				free(current->output_file->filename);
-			free(current->output_file);
+			free(pl->cmds[i].redirs[j].filename);
+			if (pl->cmds[i].redirs[j].type == T_HERESTRING
+				&& pl->cmds[i].redirs[j].fd >= 0)
+				close(pl->cmds[i].redirs[j].fd);
 		}
-		free(current);
-		current = next;	
 	}
+	free(pl);
 }
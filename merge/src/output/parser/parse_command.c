@@ -16,35 +16,33 @@ static int	is_valid_command(t_cmd *cmd)
 {
 	if (cmd->args)
 		return (SUCCESS);
-	if (cmd->input_file->filename || cmd->output_file->filename)
-		return (SUCCESS);
-	if (cmd->hd != -1)
+	if (cmd->redir_count)
 		return (SUCCESS);
 	return (FAILURE);	
 }
 
-t_cmd	*parse_simple_command(t_token **current, t_prompt *prompt)
+// cmd는 파이프라인 배열 안의 자리를 그대로 채움
+int	parse_simple_command(t_token **current, t_cmd *cmd, t_hd **hd)
 {
-	t_cmd	*cmd;
-
-	if (!current || !*current)
-		return (NULL);
-	cmd = create_command(prompt->hd_lst);
-	if (!cmd)
-		return (NULL);
+	if (!current || !*current || !cmd)
+		return (FAILURE);
 	while (*current && (*current)->type != T_PIPE)
 	{
 		if (is_redirect_token((*current)->type))
 		{
-			if (parse_redirections(current, cmd) == FAILURE)
-			{
-				free_commands(cmd);
-				return (NULL);
-			}
+			if (parse_redirections(current, cmd, hd) == FAILURE)
+				return (FAILURE);
 		}
 		else if ((*current)->type == T_WORD)
 		{
-			add_argument(cmd, (*current)->value);
+			if (add_argument(cmd, *current) == FAILURE)
+				return (FAILURE);
+			*current = (*current)->next;
+		}
+		else if ((*current)->type == T_BRACE)
+		{
+			if (add_brace_arguments(cmd, *current) == FAILURE)
+				return (FAILURE);
 			*current = (*current)->next;
 		}
 		else
@@ -53,19 +51,19 @@ t_cmd	*parse_simple_command(t_token **current, t_prompt *prompt)
 	if (is_valid_command(cmd) == FAILURE)
 	{
 		printf("minishell: syntax error near unexpected token\n");
-		free_commands(cmd);
-		return (NULL);
+		return (FAILURE);
 	}
-	return (cmd);
+	return (SUCCESS);
 }
 
-int	parse_redirections(t_token **current, t_cmd *cmd)
+// 리다이렉션은 나온 순서대로 cmd->redirs에 op로 쌓음
+int	parse_redirections(t_token **current, t_cmd *cmd, t_hd **hd)
 {
-	t_token_type	redir_type;
+	t_token	*op;
 
 	if (!current || !*current || !cmd)
 		return (FAILURE);
-	redir_type = (*current)->type;
+	op = *current;
 	*current = (*current)->next;
 	if (!*current || ((*current)->type != T_WORD && \
 						(*current)->type != T_CORRECT_FILNAME && \
@@ -74,16 +72,10 @@ int	parse_redirections(t_token **current, t_cmd *cmd)
 		printf("minishell: syntax error near redirection\n");
 		return (FAILURE);
 	}
-	if (redir_type == T_REDIR_IN)
-		set_input_file(cmd->input_file, *current);
-	else if (redir_type == T_REDIR_OUT)
-		set_output_file(cmd, *current, 0);
-	else if (redir_type == T_APPEND)
-		set_output_file(cmd, *current, 1);
-	else if (redir_type == T_HEREDOC)
-	{
-		// heredoc은 이미 hd_lst에서 처리됨, delimiter만 건너뛰기
-	}
+	if (set_redirection(&cmd->redirs[cmd->redir_count], op, \
+			*current, hd) == FAILURE)
+		return (FAILURE);
+	cmd->redir_count++;
 	*current = (*current)->next;
 	return (SUCCESS);
 }
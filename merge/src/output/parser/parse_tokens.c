@@ -12,55 +12,53 @@
 
 #include "parser.h"
 
-t_cmd	*parse_tokens(t_prompt *prompt)
+t_pipeline	*parse_tokens(t_prompt *prompt)
 {
-	t_token		*tokens;
 	t_token		*current;
-	t_cmd		*commands;
+	t_pipeline	*pl;
 
-	tokens = prompt->token_lst;
-	if (!tokens)
+	if (!prompt->token_lst)
 		return (NULL);
-	current = tokens;
-	commands = parse_pipeline(&current, prompt);
-	return (commands);
+	pl = create_pipeline(prompt->token_lst);
+	if (!pl)
+		return (NULL);
+	current = prompt->token_lst;
+	if (parse_pipeline(&current, pl, prompt->hd_lst) == FAILURE)
+	{
+		free_pipeline(pl);
+		return (NULL);
+	}
+	return (pl);
 }
 
-t_cmd	*parse_pipeline(t_token **current, t_prompt *prompt)
+// 각 명령어는 pl->redirs에서 자기 구간을 이어서 받아감
+int	parse_pipeline(t_token **current, t_pipeline *pl, t_hd *hd)
 {
-	t_cmd	*first_cmd;
-	t_cmd	*last_cmd;
-	t_cmd	*new_cmd;
+	t_cmd	*cmd;
+	int		i;
 
 	if (!current || !*current)
-		return (NULL);
-	first_cmd = parse_simple_command(current, prompt);
-	if (!first_cmd)
-		return (NULL);
-	last_cmd = first_cmd;
+		return (FAILURE);
 	printf("DEBUG: Starting Parse_pipeline\n");
-	printf("DEBUG: First Command parsed\n");
-	printf("%s\n", (*current)->value);
-	while (*current && (*current)->type == T_PIPE)
+	i = 0;
+	while (i < pl->cmd_count)
 	{
+		cmd = &pl->cmds[i];
+		cmd->redirs = pl->redirs + pl->redir_count;
+		if (parse_simple_command(current, cmd, &hd) == FAILURE)
+			return (FAILURE);
+		pl->redir_count += cmd->redir_count;
+		if (!*current || (*current)->type != T_PIPE)
+			break ;
 		printf("DEBUG: Found pipe, parsing next command\n");
 		*current = (*current)->next;
-		if (!*current)
+		if (!*current || (*current)->type == T_END)
 		{
 			printf("minishell: syntax error near unexpected token `|'\n");
-			free_commands(first_cmd);
-			return (NULL);
-		}
-		new_cmd = parse_simple_command(current, prompt);
-		if (!new_cmd)
-		{
-			free_commands(first_cmd);
-			return (NULL);
+			return (FAILURE);
 		}
-		printf("DEBUG: Linked new cmd to pipeline\n");
-		last_cmd->next = new_cmd;
-		last_cmd = new_cmd;
+		i++;
 	}
-	printf("DEBUG: Pipeline parsing complete, returning first_cmd\n");
-		return (first_cmd);
-}
\ No newline at end of file
+	printf("DEBUG: Pipeline parsing complete\n");
+	return (SUCCESS);
+}
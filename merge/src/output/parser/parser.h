@@ -6,17 +6,21 @@
 # include "utils.h"
 # include "stdio.h"
 
-t_cmd	*create_command(t_hd *hd_lst);
-void 	add_argument(t_cmd *cmd, char *arg);
-int		is_redirect_token(t_token_type type);
-t_cmd	*parse_tokens(t_prompt *prompt);
-t_cmd	*parse_pipeline(t_token **current, t_prompt *prompt);
-t_cmd	*parse_simple_command(t_token **current, t_prompt *prompt);
-int		parse_redirections(t_token **current, t_cmd *cmd);
-void	set_input_file(t_filename *file, t_token *current);
-void	set_output_file(t_cmd *cmd, t_token *current, int append);
-// void	set_heredoc_delimiter(t_cmd *cmd, char *delimiter);
-void	free_commands(t_cmd *commands);
-t_filename	*create_filename(void);
+# define ARGS_INIT_CAP 8
+
+void		init_command(t_cmd *cmd);
+int			reserve_args(t_cmd *cmd, int cap);
+int			add_argument(t_cmd *cmd, t_token *token);
+int			add_brace_arguments(t_cmd *cmd, t_token *token);
+int			is_redirect_token(t_token_type type);
+t_pipeline	*create_pipeline(t_token *tokens);
+t_pipeline	*clone_pipeline(t_pipeline *src);
+t_pipeline	*parse_tokens(t_prompt *prompt);
+int			parse_pipeline(t_token **current, t_pipeline *pl, t_hd *hd);
+int			parse_simple_command(t_token **current, t_cmd *cmd, t_hd **hd);
+int			parse_redirections(t_token **current, t_cmd *cmd, t_hd **hd);
+int			set_redirection(t_redir *redir, t_token *op, \
+				t_token *current, t_hd **hd);
+void		free_pipeline(t_pipeline *pl);
 
 #endif
\ No newline at end of file
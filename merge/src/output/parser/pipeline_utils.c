@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipeline_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 13:20:41 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/14 13:20:41 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "parser.h"
+#include "brace.h"
+
+// 파이프 수로 명령어 개수를, 리다이렉션 토큰 수로 op 개수를 미리 셈
+static void	count_pipeline(t_token *token, int *cmd_count, int *redir_count)
+{
+	*cmd_count = 1;
+	*redir_count = 0;
+	while (token && token->type != T_END)
+	{
+		if (token->type == T_PIPE)
+			(*cmd_count)++;
+		else if (is_redirect_token(token->type))
+			(*redir_count)++;
+		token = token->next;
+	}
+}
+
+// 명령어별 단어 수만큼 argv를 미리 잡아둠 (리다이렉션 대상은 제외)
+static int	reserve_pipeline_args(t_pipeline *pl, t_token *token)
+{
+	int	i;
+	int	words;
+
+	i = 0;
+	words = 0;
+	while (i < pl->cmd_count)
+	{
+		if (!token || token->type == T_PIPE || token->type == T_END)
+		{
+			if (words && reserve_args(&pl->cmds[i], words + 1) == FAILURE)
+				return (FAILURE);
+			words = 0;
+			i++;
+		}
+		else if (is_redirect_token(token->type) && token->next)
+			token = token->next;
+		else if (token->type == T_WORD)
+			words++;
+		else if (token->type == T_BRACE)
+			words += brace_word_count(token->value);
+		if (token)
+			token = token->next;
+	}
+	return (SUCCESS);
+}
+
+// 파이프라인 구조체, 명령어 배열, 리다이렉션 배열을 한 번에 할당
+t_pipeline	*create_pipeline(t_token *tokens)
+{
+	t_pipeline	*pl;
+	int			cmd_count;
+	int			redir_count;
+	int			i;
+
+	count_pipeline(tokens, &cmd_count, &redir_count);
+	pl = malloc(sizeof(t_pipeline) + sizeof(t_cmd) * cmd_count
+			+ sizeof(t_redir) * redir_count);
+	if (!pl)
+		return (NULL);
+	pl->cmds = (t_cmd *)(pl + 1);
+	pl->cmd_count = cmd_count;
+	pl->redirs = (t_redir *)(pl->cmds + cmd_count);
+	pl->redir_count = 0;
+	i = -1;
+	while (++i < cmd_count)
+		init_command(&pl->cmds[i]);
+	if (reserve_pipeline_args(pl, tokens) == FAILURE)
+	{
+		free_pipeline(pl);
+		return (NULL);
+	}
+	return (pl);
+}
+
+// 명령어 하나를 문자열까지 복사 (리다이렉션 구간은 dst 블록 안의 같은 위치)
+static int	clone_command(t_cmd *dst, t_cmd *src, t_redir *redirs)
+{
+	int	i;
+
+	dst->redirs = redirs;
+	if (src->argc && reserve_args(dst, src->argc + 1) == FAILURE)
+		return (FAILURE);
+	while (dst->argc < src->argc)
+	{
+		dst->args[dst->argc] = ft_strdup(src->args[dst->argc]);
+		if (!dst->args[dst->argc])
+			return (FAILURE);
+		dst->args[++dst->argc] = NULL;
+	}
+	i = -1;
+	while (++i < src->redir_count)
+	{
+		dst->redirs[i] = src->redirs[i];
+		dst->redirs[i].filename = NULL;
+		dst->redir_count = i + 1;
+		if (src->redirs[i].filename)
+			dst->redirs[i].filename = ft_strdup(src->redirs[i].filename);
+		if (src->redirs[i].filename && !dst->redirs[i].filename)
+			return (FAILURE);
+	}
+	return (SUCCESS);
+}
+
+// 캐시해둔 파이프라인을 같은 모양의 새 블록으로 복사
+t_pipeline	*clone_pipeline(t_pipeline *src)
+{
+	t_pipeline	*pl;
+	int			i;
+
+	pl = malloc(sizeof(t_pipeline) + sizeof(t_cmd) * src->cmd_count
+			+ sizeof(t_redir) * src->redir_count);
+	if (!pl)
+		return (NULL);
+	pl->cmds = (t_cmd *)(pl + 1);
+	pl->cmd_count = src->cmd_count;
+	pl->redirs = (t_redir *)(pl->cmds + src->cmd_count);
+	pl->redir_count = src->redir_count;
+	i = -1;
+	while (++i < pl->cmd_count)
+		init_command(&pl->cmds[i]);
+	i = -1;
+	while (++i < pl->cmd_count)
+	{
+		if (clone_command(&pl->cmds[i], &src->cmds[i],
+				pl->redirs + (src->cmds[i].redirs - src->redirs)) == FAILURE)
+		{
+			free_pipeline(pl);
+			return (NULL);
+		}
+	}
+	return (pl);
+}
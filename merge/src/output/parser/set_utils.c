@@ -11,88 +11,56 @@
 /* ************************************************************************** */
 
 #include "parser.h"
+#include "executor.h"
+#include <limits.h>
 
-t_filename	*create_filename(void)
+// op 값 앞의 숫자가 대상 fd (2>, 3<&), 없으면 <쪽은 0, >쪽은 1
+static int	redirect_target(t_token *op)
 {
-	t_filename	*new;
+	long	n;
+	int		i;
 
-	new = malloc(sizeof(t_filename));
-	if (!new)
-		return (NULL);
-	new->filename = NULL;
-	new->flag = 0;
-	new->next = NULL;
-
-	return (new);
-}
-
-void	set_input_file(t_filename *file, t_token *current)
-{
-	if (!file || !current || !current->value)
-		return ;
-	if (file->filename)
-		free(file->filename);
-	file->filename = malloc(ft_strlen(current->value) + 1);
-	if (!file->filename)
-		return ;
-	ft_strcpy(file->filename, current->value);
-	if (current->type == T_WRONG_FILNAME)
-		file->flag = 1;
-}
-
-static void	add_filename_to_list(t_filename **head, t_filename *new_node)
-{
-	t_filename	*current;
-
-	if (!head || !new_node)
-		return ;
-	if (!*head)
-	{
-		*head = new_node;
-		return ;
-	}
-	current = *head;
-	while (current->next)
-		current = current->next;
-	current->next = new_node;
+	if (!ft_isdigit(op->value[0]))
+		return (op->value[ft_strlen(op->value) - 1] == '>'
+			|| op->type == T_DUP_OUT);
+	n = 0;
+	i = 0;
+	while (ft_isdigit(op->value[i]) && n <= INT_MAX)
+		n = n * 10 + op->value[i++] - '0';
+	if (n > INT_MAX)
+		return (-1);
+	return ((int)n);
 }
 
-void	set_output_file(t_cmd *cmd, t_token *current, int append)
+// 파일 이름은 토큰에서 그대로 가져옴 (N>&M, N>&-는 M, -가 파일 이름 자리)
+// heredoc은 이미 hd_lst에 토큰 순서대로 읽어둔 fd를 하나씩 꺼내 씀
+// here-string은 여기서(부모에서) 내용을 fd에 써두고 실행할 때 붙이기만 함
+int	set_redirection(t_redir *redir, t_token *op, t_token *current, \
+		t_hd **hd)
 {
-	t_filename	*new_file;
-
-	if (!cmd || !current || !current->value)
-		return ;
-	if (cmd->output_file->filename == NULL)
+	redir->type = op->type;
+	redir->filename = NULL;
+	redir->fd = -1;
+	redir->flag = (current->type == T_WRONG_FILNAME);
+	redir->io = redirect_target(op);
+	redir->saved = -1;
+	if (redir->type == T_HEREDOC)
 	{
-		cmd->output_file->filename = ft_strdup(current->value);
-		if (!cmd->output_file->filename)
-			return ;
-		if (current->type == T_WRONG_FILNAME)
-			cmd->output_file->flag = 1;
-		cmd->output_file->append_mode = append;
+		if (!hd || !*hd)
+			return (FAILURE);
+		redir->fd = (*hd)->fd;
+		*hd = (*hd)->next;
+		return (SUCCESS);
 	}
-	else
+	if (!current->value)
+		return (FAILURE);
+	redir->filename = current->value;
+	current->value = NULL;
+	if (redir->type == T_HERESTRING)
 	{
-		new_file = create_filename();
-		new_file->filename = ft_strdup(current->value);
-		if (!new_file)
-			return ;
-		if (current->type == T_WRONG_FILNAME)
-			new_file->flag = 1;
-		new_file->append_mode = append;
-		add_filename_to_list(&(cmd->output_file), new_file);
+		redir->fd = open_herestring(redir->filename);
+		if (redir->fd < 0)
+			return (perror("here-string"), FAILURE);
 	}
+	return (SUCCESS);
 }
-
-// void	set_heredoc_delimiter(t_cmd *cmd, char *delimiter)
-// {
-// 	if (!cmd || !delimiter)
-// 		return ;
-// 	if (cmd->heredoc_delimiter)
-// 		free(cmd->heredoc_delimiter);
-// 	cmd->heredoc_delimiter = malloc(ft_strlen(delimiter) + 1);
-// 	if (!cmd->heredoc_delimiter)
-// 		return ;
-// 	ft_strcpy(cmd->heredoc_delimiter, delimiter);
-// }
\ No newline at end of file
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jechoi <jechoi@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:10:18 by jechoi            #+#    #+#             */
+/*   Updated: 2025/09/17 11:10:18 by jechoi           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "output.h"
+#include "input.h"
+#include "list.h"
+#include "ast.h"
+
+static char	*fd_path(int fd)
+{
+	char	*num;
+	char	*path;
+
+	num = ft_itoa(fd);
+	if (!num)
+		return (NULL);
+	path = ft_strjoin("/dev/fd/", num);
+	free(num);
+	return (path);
+}
+
+//<( body ) / >( body ): body를 파싱해서 자식으로 띄우고 파이프의 경로를 돌려줌
+//디스크에 임시 파일을 만들지 않음, 자식은 명령이 끝난 뒤 reap_procsubs에서 회수
+char	*process_subst(char *body, int to_cmd)
+{
+	t_prompt	prompt;
+	t_pipeline	*pl;
+	int			fd;
+
+	ft_memset(&prompt, 0, sizeof(t_prompt));
+	prompt.input = body;
+	prompt.shell = current_shell(NULL);
+	pl = NULL;
+	if (line_process(&prompt, 0) && prompt.token_lst && !prompt.ast
+		&& prompt.token_lst->type != T_END)
+		pl = parse_tokens(&prompt);
+	fd = start_procsub(&prompt, pl, to_cmd);
+	free_pipeline(pl);
+	free_ast(prompt.ast);
+	clear_token_list(&prompt.token_lst);
+	clear_hd_list(&prompt.hd_lst);
+	if (fd < 0)
+		return (NULL);
+	return (fd_path(fd));
+}
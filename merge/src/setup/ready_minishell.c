@@ -15,6 +15,16 @@
 #include "sigft.h"
 #include <stdio.h>
 
+//확장 단계는 t_shell을 받지 않아서 준비할 때 한번 등록해 둠
+t_shell	*current_shell(t_shell *shell)
+{
+	static t_shell	*registered;
+
+	if (shell)
+		registered = shell;
+	return (registered);
+}
+
 int	ready_minishell(t_prompt *prompt, t_shell *shell, char **envp)
 {
 	ft_memset(prompt, 0, sizeof(t_prompt));
@@ -25,6 +35,8 @@ int	ready_minishell(t_prompt *prompt, t_shell *shell, char **envp)
 	if (init_shell(shell) != SUCCESS)
 		return (printf("Failed to init shell\n"), FAILURE);
 	shell->envp_list = prompt->envp_lst;
+	prompt->shell = shell;
+	current_shell(shell);
 	shell->env_array = env_list_to_array(shell->envp_list);
 	return (1);
 }
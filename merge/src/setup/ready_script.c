@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ready_script.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 11:05:27 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 11:05:27 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "setup.h"
+#include "script.h"
+#include "global.h"
+#include <errno.h>
+#include <string.h>
+
+//스크립트를 못 열면 bash처럼 없는 파일은 127, 나머지는 126
+static int	script_error(const char *path)
+{
+	g_exit_status = 126 + (errno == ENOENT);
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd((char *)path, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putendl_fd(strerror(errno), 2);
+	return (0);
+}
+
+//minishell -c 'cmds' [name [args...]]: name이 $0, 나머지가 $1부터
+static int	ready_command(t_shell *shell, t_script *sc, int ac, char **av)
+{
+	if (ac < 3)
+	{
+		ft_putendl_fd("minishell: -c: option requires an argument", 2);
+		g_exit_status = 2;
+		return (0);
+	}
+	if (ac > 3)
+	{
+		shell->params = av + 3;
+		shell->param_count = ac - 4;
+	}
+	if (!script_from_string(sc, av[2]))
+		return (0);
+	shell->script = sc;
+	return (1);
+}
+
+//실행 방식을 정하고 위치 인자는 av를 그대로 가리킴 (params[0]이 $0)
+//minishell script [args...]: 파일을 mmap해서 한 줄씩
+//minishell: stdin이 tty가 아니면 stdin 전체를 스크립트로, tty면 readline
+int	ready_script(t_shell *shell, t_script *sc, int ac, char **av)
+{
+	shell->params = av;
+	if (ac > 1 && ft_strcmp(av[1], "-c") == 0)
+		return (ready_command(shell, sc, ac, av));
+	if (ac > 1)
+	{
+		shell->params = av + 1;
+		shell->param_count = ac - 2;
+		if (!script_open(sc, av[1]))
+			return (script_error(av[1]));
+		shell->script = sc;
+	}
+	else if (!isatty(STDIN_FILENO))
+	{
+		if (!script_from_fd(sc, STDIN_FILENO))
+			return (script_error("stdin"));
+		shell->script = sc;
+	}
+	return (1);
+}
@@ -17,5 +17,6 @@
 
 t_envp	*set_envp(char **envp);
 int		ready_minishell(t_prompt *prompt, t_shell *shell, char **envp);
+int		ready_script(t_shell *shell, t_script *sc, int ac, char **av);
 
 #endif
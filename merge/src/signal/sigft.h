@@ -11,8 +11,10 @@
 void	setup_signals(void);
 void	signal_handler_interactive(int sig);
 void	signal_handler_noninteractive(int sig);
+void	signal_handler_heredoc(int sig);
 void	setup_signals_interactive(void);
 void	setup_signals_noninteractive(void);
+void	setup_signals_heredoc(void);
 void	setup_signals_child(void);
 void	handle_signal_in_loop(t_shell *shell);
 
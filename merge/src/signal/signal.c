@@ -52,4 +52,10 @@ void	signal_handler_noninteractive(int sig)
 		printf("\n");
 	else if (sig == SIGQUIT)
 		printf("Quit: %d\n", sig);
-}
\ No newline at end of file
+}
+
+//heredoc 입력 중 SIGINT: 플래그만 세우고 readline event hook에서 종료
+void	signal_handler_heredoc(int sig)
+{
+	g_signal_received = sig;
+}
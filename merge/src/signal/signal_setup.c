@@ -43,6 +43,16 @@ void	setup_signals_noninteractive(void)
 	sigaction(SIGQUIT, &sa_quit, NULL);
 }
 
+void	setup_signals_heredoc(void)
+{
+	struct sigaction	sa_int;
+
+	sigemptyset(&sa_int.sa_mask);
+	sa_int.sa_handler = signal_handler_heredoc;
+	sa_int.sa_flags = 0;
+	sigaction(SIGINT, &sa_int, NULL);
+}
+
 void	setup_signals_child(void)
 {
 	struct sigaction	sa_int;
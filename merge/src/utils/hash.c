@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 15:47:20 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 15:47:20 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils.h"
+
+//djb2 해시 (캐시 키 비교 전에 빠르게 걸러내는 용도)
+unsigned long	hash_bytes(const char *s, size_t n)
+{
+	unsigned long	hash;
+	size_t			i;
+
+	hash = 5381;
+	i = 0;
+	while (i < n)
+	{
+		hash = ((hash << 5) + hash) + (unsigned char)s[i];
+		i++;
+	}
+	return (hash);
+}
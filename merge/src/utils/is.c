@@ -20,7 +20,8 @@ int	is_space(char c)
 
 int	is_operator(char c)
 {
-	return (c == '|' || c == '<' || c == '>');
+	return (c == '|' || c == '<' || c == '>' || c == ';' || c == '('
+		|| c == ')');
 }
 
 int	is_quote(char c)
@@ -30,8 +31,9 @@ int	is_quote(char c)
 
 int	is_redir_type(t_token_type type)
 {
-	return (type == T_APPEND || type == T_HEREDOC || \
-			type == T_REDIR_IN || type == T_REDIR_OUT);
+	return (type == T_APPEND || type == T_HEREDOC || type == T_HERESTRING \
+			|| type == T_REDIR_IN || type == T_REDIR_OUT \
+			|| type == T_DUP_IN || type == T_DUP_OUT);
 }
 
 int	is_valid_expand(t_exp *exp_data, char *value)
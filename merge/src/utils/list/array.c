@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:05:12 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 17:05:12 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+#include "utils.h"
+
+//name이 있는 칸의 항목을 가리키는 자리, 없으면 그 칸의 끝 (NULL이 든 자리)
+static t_array	**array_slot(t_shell *shell, const char *name, size_t len,
+					unsigned long hash)
+{
+	t_array	**slot;
+
+	slot = &shell->arrays[hash % ARRAY_BUCKETS];
+	while (*slot && ((*slot)->hash != hash
+			|| ft_strncmp((*slot)->name, name, len) != 0
+			|| (*slot)->name[len] != '\0'))
+		slot = &(*slot)->next;
+	return (slot);
+}
+
+//배열이 하나도 없으면 표도 없으니 바로 NULL
+t_array	*find_array(t_shell *shell, const char *name, size_t len)
+{
+	if (!shell || !shell->arrays)
+		return (NULL);
+	return (*array_slot(shell, name, len, hash_bytes(name, len)));
+}
+
+//이미 있으면 그대로 (원소도 종류도 그대로), 없으면 빈 배열을 만듦
+t_array	*add_array(t_shell *shell, const char *name, int assoc)
+{
+	t_array			**slot;
+	unsigned long	hash;
+	size_t			len;
+
+	if (!shell->arrays)
+		shell->arrays = ft_calloc(ARRAY_BUCKETS, sizeof(t_array *));
+	if (!shell->arrays)
+		return (NULL);
+	len = ft_strlen(name);
+	hash = hash_bytes(name, len);
+	slot = array_slot(shell, name, len, hash);
+	if (*slot)
+		return (*slot);
+	*slot = ft_calloc(1, sizeof(t_array));
+	if (!*slot)
+		return (NULL);
+	(*slot)->name = ft_strdup(name);
+	(*slot)->hash = hash;
+	(*slot)->assoc = assoc;
+	if (assoc)
+		(*slot)->keys = ft_calloc(ASSOC_BUCKETS, sizeof(t_assoc *));
+	if (!(*slot)->name || (assoc && !(*slot)->keys))
+		return (free_array(*slot), *slot = NULL, NULL);
+	return (*slot);
+}
+
+void	remove_array(t_shell *shell, const char *name)
+{
+	t_array	**slot;
+	t_array	*arr;
+	size_t	len;
+
+	if (!shell->arrays)
+		return ;
+	len = ft_strlen(name);
+	slot = array_slot(shell, name, len, hash_bytes(name, len));
+	arr = *slot;
+	if (!arr)
+		return ;
+	*slot = arr->next;
+	free_array(arr);
+}
+
+void	clear_arrays(t_shell *shell)
+{
+	t_array	*arr;
+	t_array	*next;
+	int		i;
+
+	if (!shell->arrays)
+		return ;
+	i = 0;
+	while (i < ARRAY_BUCKETS)
+	{
+		arr = shell->arrays[i++];
+		while (arr)
+		{
+			next = arr->next;
+			free_array(arr);
+			arr = next;
+		}
+	}
+	free(shell->arrays);
+	shell->arrays = NULL;
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_elem.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:21:40 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 17:21:40 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+
+//i번 자리에 value를 넣음 (복사하지 않고 그대로 가짐), 실패하면 value를 버림
+//모자라면 두배씩 늘리고 새 자리는 NULL
+int	array_put(t_array *arr, size_t i, char *value)
+{
+	char	**vals;
+	size_t	cap;
+
+	cap = arr->cap;
+	if (cap == 0)
+		cap = 8;
+	while (cap <= i)
+		cap *= 2;
+	if (cap != arr->cap)
+	{
+		vals = ft_calloc(cap, sizeof(char *));
+		if (!vals)
+			return (free(value), 0);
+		if (arr->vals)
+			ft_memcpy(vals, arr->vals, arr->len * sizeof(char *));
+		free(arr->vals);
+		arr->vals = vals;
+		arr->cap = cap;
+	}
+	arr->count += (arr->vals[i] == NULL);
+	free(arr->vals[i]);
+	arr->vals[i] = value;
+	if (i >= arr->len)
+		arr->len = i + 1;
+	return (1);
+}
+
+int	array_set(t_array *arr, size_t i, const char *value)
+{
+	char	*dup;
+
+	dup = ft_strdup(value);
+	if (!dup)
+		return (0);
+	return (array_put(arr, i, dup));
+}
+
+//없는 원소면 NULL (unset과 같음)
+const char	*array_get(t_array *arr, size_t i)
+{
+	if (arr->assoc || i >= arr->len)
+		return (NULL);
+	return (arr->vals[i]);
+}
+
+//빈 자리로 만들고, 마지막 원소였으면 len을 앞쪽 원소까지 줄임
+void	array_unset(t_array *arr, size_t i)
+{
+	if (arr->assoc || i >= arr->len || !arr->vals[i])
+		return ;
+	free(arr->vals[i]);
+	arr->vals[i] = NULL;
+	arr->count--;
+	while (arr->len && !arr->vals[arr->len - 1])
+		arr->len--;
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_free.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:26:03 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 17:26:03 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+
+static void	free_bucket(t_assoc *e)
+{
+	t_assoc	*next;
+
+	while (e)
+	{
+		next = e->next;
+		free(e->key);
+		free(e->value);
+		free(e);
+		e = next;
+	}
+}
+
+//원소만 모두 지움 (a=(...)로 다시 채우기 전에), 종류와 이름은 그대로
+void	array_empty(t_array *arr)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < arr->len)
+	{
+		free(arr->vals[i]);
+		arr->vals[i++] = NULL;
+	}
+	arr->len = 0;
+	i = 0;
+	while (arr->keys && i < ASSOC_BUCKETS)
+	{
+		free_bucket(arr->keys[i]);
+		arr->keys[i++] = NULL;
+	}
+	arr->count = 0;
+}
+
+void	free_array(t_array *arr)
+{
+	array_empty(arr);
+	free(arr->vals);
+	free(arr->keys);
+	free(arr->name);
+	free(arr);
+}
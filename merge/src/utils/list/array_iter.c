@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_iter.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:41:55 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 17:41:55 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+
+//첨자를 num 끝에서부터 10진수로 써서 key로
+static void	index_key(t_aiter *it)
+{
+	size_t	n;
+	char	*p;
+
+	n = it->i;
+	p = it->num + 23;
+	*p = '\0';
+	*--p = '0' + n % 10;
+	while (n / 10)
+	{
+		n /= 10;
+		*--p = '0' + n % 10;
+	}
+	it->key = p;
+}
+
+//다음 원소로 넘어가서 it->key, it->value에 둠, 끝이면 0 (it는 0으로 채워서 시작)
+//첨자 배열은 첨자 순서, 연관 배열은 해시 칸 순서
+int	array_next(t_array *arr, t_aiter *it)
+{
+	if (!arr->assoc)
+	{
+		while (it->i < arr->len && !arr->vals[it->i])
+			it->i++;
+		if (it->i >= arr->len)
+			return (0);
+		it->value = arr->vals[it->i];
+		index_key(it);
+		it->i++;
+		return (1);
+	}
+	if (it->e)
+		it->e = it->e->next;
+	while (!it->e && it->i < ASSOC_BUCKETS)
+		it->e = arr->keys[it->i++];
+	if (!it->e)
+		return (0);
+	it->key = it->e->key;
+	it->value = it->e->value;
+	return (1);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   assoc.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 17:34:08 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/18 17:34:08 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+#include "utils.h"
+
+//key가 있는 칸의 원소를 가리키는 자리, 없으면 그 칸의 끝
+static t_assoc	**assoc_slot(t_array *arr, const char *key, unsigned long hash)
+{
+	t_assoc	**slot;
+
+	slot = &arr->keys[hash % ASSOC_BUCKETS];
+	while (*slot && ((*slot)->hash != hash
+			|| ft_strcmp((*slot)->key, (char *)key) != 0))
+		slot = &(*slot)->next;
+	return (slot);
+}
+
+int	assoc_set(t_array *arr, const char *key, const char *value)
+{
+	t_assoc			**slot;
+	char			*dup;
+	unsigned long	hash;
+
+	dup = ft_strdup(value);
+	if (!dup)
+		return (0);
+	hash = hash_bytes(key, ft_strlen(key));
+	slot = assoc_slot(arr, key, hash);
+	if (!*slot)
+	{
+		*slot = ft_calloc(1, sizeof(t_assoc));
+		if (!*slot)
+			return (free(dup), 0);
+		(*slot)->key = ft_strdup(key);
+		if (!(*slot)->key)
+			return (free(dup), free(*slot), *slot = NULL, 0);
+		(*slot)->hash = hash;
+		arr->count++;
+	}
+	free((*slot)->value);
+	(*slot)->value = dup;
+	return (1);
+}
+
+const char	*assoc_get(t_array *arr, const char *key)
+{
+	t_assoc	*e;
+
+	if (!arr->assoc)
+		return (NULL);
+	e = *assoc_slot(arr, key, hash_bytes(key, ft_strlen(key)));
+	if (!e)
+		return (NULL);
+	return (e->value);
+}
+
+void	assoc_unset(t_array *arr, const char *key)
+{
+	t_assoc	**slot;
+	t_assoc	*e;
+
+	if (!arr->assoc)
+		return ;
+	slot = assoc_slot(arr, key, hash_bytes(key, ft_strlen(key)));
+	e = *slot;
+	if (!e)
+		return ;
+	*slot = e->next;
+	free(e->key);
+	free(e->value);
+	free(e);
+	arr->count--;
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hd_cache.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 15:58:43 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 15:58:43 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+#include "utils.h"
+
+//body는 그대로 소유권을 넘겨받음
+t_hd_cache	*create_hd_cache(char *body, size_t len, int fd)
+{
+	t_hd_cache	*new_cache;
+
+	new_cache = (t_hd_cache *)malloc(sizeof(t_hd_cache));
+	if (!new_cache)
+	{
+		perror("malloc fail : create_hd_cache");
+		return (NULL);
+	}
+	lru_key(&new_cache->lru, body, len);
+	new_cache->fd = fd;
+	return (new_cache);
+}
+
+static void	delone_hd_cache(t_lru *node)
+{
+	close(((t_hd_cache *)node)->fd);
+	free(node->key);
+	free(node);
+}
+
+//본문 텍스트가 키, 찾으면 맨 앞으로 옮겨짐
+t_hd_cache	*find_hd_cache(t_lru **cache, char *body, size_t len)
+{
+	return ((t_hd_cache *)lru_find(cache, body, len));
+}
+
+//맨 앞에 넣고 HD_CACHE_MAX개가 넘으면 제일 뒤를 버림
+void	push_hd_cache(t_lru **cache, t_hd_cache *new)
+{
+	lru_push(cache, &new->lru, HD_CACHE_MAX, delone_hd_cache);
+}
+
+void	clear_hd_cache(t_lru **cache)
+{
+	lru_trim(cache, 0, delone_hd_cache);
+}
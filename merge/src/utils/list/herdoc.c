@@ -23,6 +23,7 @@ t_hd	*create_hd(int fd)
 		return (NULL);
 	}
 	new_hd->fd = fd;
+	new_hd->raw = NULL;
 	new_hd->next = NULL;
 	return (new_hd);
 }
@@ -63,6 +64,7 @@ void	clear_hd_list(t_hd **hd_list)
 	{
 		next = curr->next;
 		close(curr->fd);
+		free(curr->raw);
 		free(curr);
 		curr = NULL;
 		curr = next;
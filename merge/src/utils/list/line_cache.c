@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   line_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 15:02:17 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 15:02:17 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+#include "utils.h"
+#include "parser.h"
+
+//line과 raw 토큰은 그대로 소유권을 넘겨받음
+t_line_cache	*create_line_cache(char *line, t_token *raw, int has_var)
+{
+	t_line_cache	*new_cache;
+
+	new_cache = (t_line_cache *)malloc(sizeof(t_line_cache));
+	if (!new_cache)
+	{
+		perror("malloc fail : create_line_cache");
+		return (NULL);
+	}
+	lru_key(&new_cache->lru, line, ft_strlen(line));
+	new_cache->raw = raw;
+	new_cache->has_var = has_var;
+	new_cache->env_gen = 0;
+	new_cache->pl = NULL;
+	return (new_cache);
+}
+
+static void	delone_line_cache(t_lru *node)
+{
+	t_line_cache	*entry;
+
+	entry = (t_line_cache *)node;
+	free(node->key);
+	clear_token_list(&entry->raw);
+	free_pipeline(entry->pl);
+	free(entry);
+}
+
+//입력 줄 그대로가 키, 찾으면 맨 앞으로 옮겨짐
+t_line_cache	*find_line_cache(t_lru **cache, char *line)
+{
+	return ((t_line_cache *)lru_find(cache, line, ft_strlen(line)));
+}
+
+//맨 앞에 넣고 LINE_CACHE_MAX개가 넘으면 제일 뒤를 버림
+void	push_line_cache(t_lru **cache, t_line_cache *new)
+{
+	lru_push(cache, &new->lru, LINE_CACHE_MAX, delone_line_cache);
+}
+
+void	clear_line_cache(t_lru **cache)
+{
+	lru_trim(cache, 0, delone_line_cache);
+}
@@ -15,6 +15,23 @@
 # include "types.h"
 # include <stdlib.h>
 # include <stdio.h>
+# define HD_CACHE_MAX 16
+# define LINE_CACHE_MAX 64
+# define SRC_CACHE_MAX 16
+# define SRC_CACHE_MAX_BODY 1048576
+# define ARRAY_BUCKETS 64
+# define ASSOC_BUCKETS 32
+
+//배열 원소를 차례로 볼 때의 위치, key/value는 지금 원소
+//첨자 배열의 key는 num에 쓴 숫자
+typedef struct s_aiter
+{
+	size_t		i;
+	t_assoc		*e;
+	const char	*key;
+	const char	*value;
+	char		num[24];
+}	t_aiter;
 
 //envp list fuction
 t_envp	*create_envp(char *title, char *value);
@@ -28,6 +45,7 @@ t_token	*find_last_token(t_token *token_list);
 void	addback_token(t_token **token_list, t_token *new);
 void	clear_token_list(t_token **token_list);
 int		add_new_token(t_token **token_lst, char *value, t_token_type type);
+t_token	*dup_token_list(t_token *src);
 
 //herdoc list fuction
 t_hd	*create_hd(int fd);
@@ -36,4 +54,47 @@ void	addback_hd(t_hd **hd_list, t_hd *new);
 void	clear_hd_list(t_hd **hd_list);
 int		add_new_hd(t_hd **hd_lst, int fd);
 
+//lru list fuction
+void		lru_key(t_lru *node, char *key, size_t len);
+t_lru		*lru_find(t_lru **head, const char *key, size_t len);
+void		lru_push(t_lru **head, t_lru *node, int max,
+				void (*del)(t_lru *));
+void		lru_trim(t_lru **head, int keep, void (*del)(t_lru *));
+
+//herdoc cache list fuction
+t_hd_cache	*create_hd_cache(char *body, size_t len, int fd);
+t_hd_cache	*find_hd_cache(t_lru **cache, char *body, size_t len);
+void		push_hd_cache(t_lru **cache, t_hd_cache *new);
+void		clear_hd_cache(t_lru **cache);
+
+//line cache list fuction
+t_line_cache	*create_line_cache(char *line, t_token *raw, int has_var);
+t_line_cache	*find_line_cache(t_lru **cache, char *line);
+void			push_line_cache(t_lru **cache, t_line_cache *new);
+void			clear_line_cache(t_lru **cache);
+
+//source cache list fuction
+t_src_cache		*create_src_cache(const char *path, struct timespec mtime,
+					char *data, off_t size);
+t_src_cache		*find_src_cache(t_lru **cache, const char *path,
+					struct timespec mtime, off_t size);
+void			push_src_cache(t_lru **cache, t_src_cache *new);
+void			clear_src_cache(t_lru **cache);
+
+//array fuction
+t_array			*find_array(t_shell *shell, const char *name, size_t len);
+t_array			*add_array(t_shell *shell, const char *name, int assoc);
+void			remove_array(t_shell *shell, const char *name);
+void			clear_arrays(t_shell *shell);
+int				array_put(t_array *arr, size_t i, char *value);
+int				array_set(t_array *arr, size_t i, const char *value);
+const char		*array_get(t_array *arr, size_t i);
+void			array_unset(t_array *arr, size_t i);
+void			array_empty(t_array *arr);
+void			free_array(t_array *arr);
+int				assoc_set(t_array *arr, const char *key, const char *value);
+const char		*assoc_get(t_array *arr, const char *key);
+void			assoc_unset(t_array *arr, const char *key);
+int				array_next(t_array *arr, t_aiter *it);
+
 #endif
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lru.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 17:02:41 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 17:02:41 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+#include "utils.h"
+
+//캐시 항목 맨 앞의 공통 노드를 채움, key는 항목이 소유함
+//해시는 전체 비교 전에 빠르게 걸러내는 용도
+void	lru_key(t_lru *node, char *key, size_t len)
+{
+	node->key = key;
+	node->len = len;
+	node->hash = hash_bytes(key, len);
+	node->next = NULL;
+}
+
+//찾으면 리스트 맨 앞으로 옮겨서 반환 (오래 안쓴 것이 뒤로 밀림)
+t_lru	*lru_find(t_lru **head, const char *key, size_t len)
+{
+	t_lru			**link;
+	t_lru			*node;
+	unsigned long	hash;
+
+	hash = hash_bytes(key, len);
+	link = head;
+	while (*link && !((*link)->len == len && (*link)->hash == hash
+			&& ft_memcmp((*link)->key, key, len) == 0))
+		link = &(*link)->next;
+	node = *link;
+	if (!node || link == head)
+		return (node);
+	*link = node->next;
+	node->next = *head;
+	*head = node;
+	return (node);
+}
+
+//앞에서 keep개만 남기고 나머지는 del로 해제, keep이 0이면 전부 해제
+void	lru_trim(t_lru **head, int keep, void (*del)(t_lru *))
+{
+	t_lru	*next;
+
+	while (*head && keep-- > 0)
+		head = &(*head)->next;
+	while (*head)
+	{
+		next = (*head)->next;
+		del(*head);
+		*head = next;
+	}
+}
+
+//맨 앞에 넣고 max개가 넘으면 제일 뒤부터 버림
+void	lru_push(t_lru **head, t_lru *node, int max, void (*del)(t_lru *))
+{
+	node->next = *head;
+	*head = node;
+	lru_trim(head, max, del);
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   src_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/17 18:12:06 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/17 18:12:06 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+#include "utils.h"
+
+//data는 그대로 소유권을 넘겨받음, 경로가 키
+t_src_cache	*create_src_cache(const char *path, struct timespec mtime,
+		char *data, off_t size)
+{
+	t_src_cache	*new_cache;
+	char		*key;
+
+	new_cache = (t_src_cache *)malloc(sizeof(t_src_cache));
+	key = ft_strdup(path);
+	if (!new_cache || !key)
+		return (free(new_cache), free(key), NULL);
+	lru_key(&new_cache->lru, key, ft_strlen(key));
+	new_cache->mtime = mtime;
+	new_cache->size = size;
+	new_cache->data = data;
+	return (new_cache);
+}
+
+static void	delone_src_cache(t_lru *node)
+{
+	free(((t_src_cache *)node)->data);
+	free(node->key);
+	free(node);
+}
+
+//경로로 찾아서 맨 앞으로 옮기고, 수정 시각과 크기까지 같아야 hit
+//파일이 바뀐 항목은 NULL (다시 읽은 내용을 push_src_cache가 그 자리에 넣음)
+t_src_cache	*find_src_cache(t_lru **cache, const char *path,
+		struct timespec mtime, off_t size)
+{
+	t_src_cache	*node;
+
+	node = (t_src_cache *)lru_find(cache, path, ft_strlen(path));
+	if (!node || node->size != size || node->mtime.tv_sec != mtime.tv_sec
+		|| node->mtime.tv_nsec != mtime.tv_nsec)
+		return (NULL);
+	return (node);
+}
+
+//같은 경로의 옛 항목이 있으면 내용만 바꿈
+//없으면 맨 앞에 넣고 SRC_CACHE_MAX개가 넘으면 제일 뒤를 버림
+void	push_src_cache(t_lru **cache, t_src_cache *new)
+{
+	t_src_cache	*old;
+
+	old = (t_src_cache *)lru_find(cache, new->lru.key, new->lru.len);
+	if (!old)
+	{
+		lru_push(cache, &new->lru, SRC_CACHE_MAX, delone_src_cache);
+		return ;
+	}
+	free(old->data);
+	old->data = new->data;
+	old->mtime = new->mtime;
+	old->size = new->size;
+	free(new->lru.key);
+	free(new);
+}
+
+void	clear_src_cache(t_lru **cache)
+{
+	lru_trim(cache, 0, delone_src_cache);
+}
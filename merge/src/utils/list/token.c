@@ -63,6 +63,7 @@ void	clear_token_list(t_token **token_list)
 		next = curr->next;
 		free(curr->value);
 		curr->value = NULL;
+		free(curr->mask);
 		free(curr);
 		curr = next;
 	}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   token_dup.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 15:10:53 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 15:10:53 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "list.h"
+#include "libft.h"
+
+static t_token	*dup_token(t_token *src)
+{
+	t_token	*new_token;
+	char	*value;
+
+	value = NULL;
+	if (src->value)
+	{
+		value = ft_strdup(src->value);
+		if (!value)
+			return (NULL);
+	}
+	new_token = create_token(value, src->type);
+	if (!new_token)
+		return (free(value), NULL);
+	if (src->mask)
+	{
+		new_token->mask = malloc(ft_strlen(value) + 1);
+		if (!new_token->mask)
+			return (clear_token_list(&new_token), NULL);
+		ft_memcpy(new_token->mask, src->mask, ft_strlen(value) + 1);
+	}
+	return (new_token);
+}
+
+//토큰 리스트를 값까지 통째로 복사 (끝을 기억해서 한번에 이어붙임)
+t_token	*dup_token_list(t_token *src)
+{
+	t_token	*head;
+	t_token	*tail;
+	t_token	*new_token;
+
+	head = NULL;
+	tail = NULL;
+	while (src)
+	{
+		new_token = dup_token(src);
+		if (!new_token)
+			return (clear_token_list(&head), NULL);
+		if (!head)
+			head = new_token;
+		else
+			tail->next = new_token;
+		tail = new_token;
+		src = src->next;
+	}
+	return (head);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   match.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:18:03 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 10:18:03 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils.h"
+
+//MATCH_REVERSE면 패턴도 뒤에서부터 읽음 (suffix 매칭)
+static t_atom	*atom_at(t_pattern *p, size_t i, int flags)
+{
+	if (flags & MATCH_REVERSE)
+		return (&p->atoms[p->count - 1 - i]);
+	return (&p->atoms[i]);
+}
+
+static int	atom_matches(t_atom *atom, char c)
+{
+	size_t	i;
+	int		found;
+
+	if (atom->type == ATOM_ANY)
+		return (1);
+	if (atom->type == ATOM_CHAR)
+		return (atom->c == c);
+	found = 0;
+	i = 0;
+	while (i < atom->cls_len && !found)
+	{
+		if (i + 2 < atom->cls_len && atom->cls[i + 1] == '-')
+		{
+			found = (c >= atom->cls[i] && c <= atom->cls[i + 2]);
+			i += 3;
+		}
+		else
+			found = (atom->cls[i++] == c);
+	}
+	return (found != atom->negate);
+}
+
+//상태 i를 켜고 '*'는 빈 문자열과도 맞으니 다음 상태도 같이 켬
+static void	add_state(t_pattern *p, char *set, size_t i, int flags)
+{
+	set[i] = 1;
+	while (i < p->count && atom_at(p, i, flags)->type == ATOM_STAR)
+		set[++i] = 1;
+}
+
+//글자 하나를 읽고 갈 수 있는 상태 집합으로 넘어감, 남은 상태가 없으면 0
+static int	step(t_pattern *p, char c, int flags)
+{
+	char	*tmp;
+	size_t	i;
+	int		alive;
+
+	ft_memset(p->next, 0, p->count + 1);
+	alive = 0;
+	i = 0;
+	while (i < p->count)
+	{
+		if (p->cur[i] && atom_at(p, i, flags)->type == ATOM_STAR)
+			add_state(p, p->next, i, flags);
+		else if (p->cur[i] && atom_matches(atom_at(p, i, flags), c))
+			add_state(p, p->next, i + 1, flags);
+		alive |= p->next[i];
+		i++;
+	}
+	alive |= p->next[p->count];
+	tmp = p->cur;
+	p->cur = p->next;
+	p->next = tmp;
+	return (alive);
+}
+
+//앞(MATCH_REVERSE면 뒤)에서부터 패턴과 맞는 가장 짧은 길이
+//(MATCH_LONGEST면 가장 긴 길이), 없으면 -1
+//백트래킹 없이 가능한 패턴 위치를 집합으로 들고 가서 O(글자수 * 패턴길이)
+long	pattern_match_len(t_pattern *p, const char *s, size_t n, int flags)
+{
+	long	found;
+	size_t	k;
+
+	found = -1;
+	ft_memset(p->cur, 0, p->count + 1);
+	add_state(p, p->cur, 0, flags);
+	k = 0;
+	while (1)
+	{
+		if (p->cur[p->count])
+		{
+			found = k;
+			if (!(flags & MATCH_LONGEST))
+				return (found);
+		}
+		if (k == n)
+			return (found);
+		if (flags & MATCH_REVERSE)
+		{
+			if (!step(p, s[n - 1 - k], flags))
+				return (found);
+		}
+		else if (!step(p, s[k], flags))
+			return (found);
+		k++;
+	}
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   match_compile.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 10:41:26 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 10:41:26 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils.h"
+
+//'['부터 ']'까지를 클래스 하나로, 닫는 ']'가 없으면 그냥 '[' 글자
+//']'가 맨 앞에 오면 클래스 안의 글자로 취급
+static size_t	parse_class(const char *pat, size_t i, t_atom *atom)
+{
+	size_t	j;
+
+	j = i + 1;
+	atom->negate = (pat[j] == '!' || pat[j] == '^');
+	if (atom->negate)
+		j++;
+	if (pat[j] == ']')
+		j++;
+	while (pat[j] && pat[j] != ']')
+		j++;
+	if (!pat[j])
+	{
+		atom->type = ATOM_CHAR;
+		atom->c = '[';
+		return (i + 1);
+	}
+	atom->type = ATOM_CLASS;
+	atom->cls = pat + i + 1 + atom->negate;
+	atom->cls_len = j - (i + 1 + atom->negate);
+	return (j + 1);
+}
+
+//패턴을 글자 단위 atom 배열로 바꿔둠 (연속된 '*'는 하나로)
+//'\'가 붙은 글자는 특수문자라도 그 글자 그대로
+//클래스는 pat 문자열을 가리키므로 매칭이 끝날 때까지 pat을 살려둬야 함
+int	pattern_compile(t_pattern *p, const char *pat)
+{
+	size_t	i;
+
+	p->count = 0;
+	p->atoms = malloc(sizeof(t_atom) * (ft_strlen(pat) + 1));
+	p->cur = malloc(ft_strlen(pat) + 2);
+	p->next = malloc(ft_strlen(pat) + 2);
+	if (!p->atoms || !p->cur || !p->next)
+		return (pattern_free(p), 0);
+	i = 0;
+	while (pat[i])
+	{
+		p->atoms[p->count].type = ATOM_CHAR;
+		p->atoms[p->count].c = pat[i];
+		if (pat[i] == '\\' && pat[i + 1])
+			p->atoms[p->count].c = pat[++i];
+		else if (pat[i] == '*')
+			p->atoms[p->count].type = ATOM_STAR;
+		else if (pat[i] == '?')
+			p->atoms[p->count].type = ATOM_ANY;
+		else if (pat[i] == '[')
+			i = parse_class(pat, i, &p->atoms[p->count]) - 1;
+		i++;
+		if (!(p->atoms[p->count].type == ATOM_STAR && p->count
+				&& p->atoms[p->count - 1].type == ATOM_STAR))
+			p->count++;
+	}
+	return (1);
+}
+
+void	pattern_free(t_pattern *p)
+{
+	free(p->atoms);
+	free(p->cur);
+	free(p->next);
+	p->atoms = NULL;
+	p->cur = NULL;
+	p->next = NULL;
+}
+
+//문자열 전체가 패턴과 맞는지
+int	pattern_match(t_pattern *p, const char *s)
+{
+	size_t	len;
+
+	len = ft_strlen(s);
+	return (pattern_match_len(p, s, len, MATCH_LONGEST) == (long)len);
+}
+
+//특수문자가 하나도 없는 패턴이면 1, *lit에 '\'를 푼 글자 그대로의 문자열
+//(*lit이 NULL이면 메모리 오류)
+int	pattern_literal(t_pattern *p, char **lit)
+{
+	size_t	i;
+
+	*lit = NULL;
+	i = 0;
+	while (i < p->count)
+		if (p->atoms[i++].type != ATOM_CHAR)
+			return (0);
+	*lit = malloc(p->count + 1);
+	if (!*lit)
+		return (1);
+	i = 0;
+	while (i < p->count)
+	{
+		(*lit)[i] = p->atoms[i].c;
+		i++;
+	}
+	(*lit)[i] = '\0';
+	return (1);
+}
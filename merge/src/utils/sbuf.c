@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sbuf.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 11:08:52 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 11:08:52 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils.h"
+
+int	sbuf_init(t_sbuf *sb, size_t cap)
+{
+	if (cap == 0)
+		cap = 64;
+	sb->data = malloc(cap);
+	if (!sb->data)
+		return (0);
+	sb->data[0] = '\0';
+	sb->len = 0;
+	sb->cap = cap;
+	return (1);
+}
+
+//n바이트(+'\0')가 더 들어갈 자리를 확보, 모자라면 두배씩 늘림
+int	sbuf_reserve(t_sbuf *sb, size_t n)
+{
+	char	*new_data;
+	size_t	new_cap;
+
+	if (sb->len + n + 1 <= sb->cap)
+		return (1);
+	new_cap = sb->cap * 2;
+	while (sb->len + n + 1 > new_cap)
+		new_cap *= 2;
+	new_data = malloc(new_cap);
+	if (!new_data)
+		return (0);
+	ft_memcpy(new_data, sb->data, sb->len + 1);
+	free(sb->data);
+	sb->data = new_data;
+	sb->cap = new_cap;
+	return (1);
+}
+
+//항상 '\0'로 끝남
+int	sbuf_append(t_sbuf *sb, const char *s, size_t n)
+{
+	if (!sbuf_reserve(sb, n))
+		return (0);
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+int	sbuf_addc(t_sbuf *sb, char c)
+{
+	return (sbuf_append(sb, &c, 1));
+}
+
+void	sbuf_free(t_sbuf *sb)
+{
+	free(sb->data);
+	sb->data = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sbuf_io.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/15 14:05:12 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/15 14:05:12 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils.h"
+#include <errno.h>
+#include <fcntl.h>
+
+//모아둔 내용을 fd에 한번에 쓰고 비우기
+int	sbuf_flush(t_sbuf *sb, int fd)
+{
+	if (!write_all(fd, sb->data, sb->len))
+		return (0);
+	sb->len = 0;
+	sb->data[0] = '\0';
+	return (1);
+}
+
+//fd를 EOF까지 읽어서 sb 뒤에 붙임
+//남은 자리에 바로 읽고, 꽉 차면 sbuf_reserve로 두배씩 늘림
+int	read_all(int fd, t_sbuf *sb)
+{
+	ssize_t	n;
+
+	while (1)
+	{
+		if (sb->cap - sb->len < 2 && !sbuf_reserve(sb, sb->cap))
+			return (0);
+		n = read(fd, sb->data + sb->len, sb->cap - sb->len - 1);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			break ;
+		sb->len += n;
+		sb->data[sb->len] = '\0';
+	}
+	return (n == 0);
+}
+
+//fd를 SHELL_FD_BASE 이상의 close-on-exec fd로 옮기고 원래 것은 닫음
+int	move_fd_high(int fd)
+{
+	int	high;
+
+	if (fd < 0)
+		return (fd);
+	high = fcntl(fd, F_DUPFD_CLOEXEC, SHELL_FD_BASE);
+	close(fd);
+	return (high);
+}
@@ -12,6 +12,10 @@
 
 #include "types.h"
 #include "utils.h"
+#include "list.h"
+#include "arith.h"
+#include "expand.h"
+#include "ast.h"
 
 void	free_env_list(t_envp *head)
 {
@@ -49,6 +53,13 @@ void	cleanup_shell(t_shell *shell)
 	if (!shell)
 		return ;
 	shell->envp_list = NULL;
+	clear_hd_cache(&shell->hd_cache);
+	clear_line_cache(&shell->line_cache);
+	clear_src_cache(&shell->src_cache);
+	clear_functions(shell);
+	clear_arrays(shell);
+	arith_trim_cache(0);
+	clear_pw_cache(&shell->pw_cache);
 	if (shell->env_array)
 	{
 		free_env_array(shell->env_array);
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dsagong <dsagong@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/14 17:20:12 by dsagong           #+#    #+#             */
+/*   Updated: 2025/09/14 17:20:12 by dsagong          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils.h"
+
+static int	add_count(t_sbuf *sb, size_t n)
+{
+	if (n >= 10 && !add_count(sb, n / 10))
+		return (0);
+	return (sbuf_addc(sb, '0' + n % 10));
+}
+
+//"이름 cache hit: N / miss: N (N%)" 한 줄
+static int	add_rate(t_sbuf *sb, const char *name, size_t hits,
+		size_t misses)
+{
+	size_t	rate;
+
+	rate = 0;
+	if (hits + misses)
+		rate = hits * 100 / (hits + misses);
+	return (sbuf_append(sb, name, ft_strlen(name))
+		&& sbuf_append(sb, " cache hit: ", 12) && add_count(sb, hits)
+		&& sbuf_append(sb, " / miss: ", 9) && add_count(sb, misses)
+		&& sbuf_append(sb, " (", 2) && add_count(sb, rate)
+		&& sbuf_append(sb, "%)\n", 3));
+}
+
+//MINISHELL_STATS가 켜져 있을 때만 캐시 통계를 stderr로 냄
+//-c나 스크립트의 stdout 결과에는 섞이지 않음
+//한번만 냄 (마지막 명령을 exec하기 직전에 냈으면 main에서 다시 안냄)
+void	report_stats(t_shell *shell)
+{
+	t_sbuf	sb;
+	t_stats	*stats;
+
+	stats = &shell->stats;
+	if (!stats->enabled || !sbuf_init(&sb, 256))
+		return ;
+	if (add_rate(&sb, "heredoc", stats->hd_cache_hits,
+			stats->hd_cache_misses)
+		&& add_rate(&sb, "line", stats->line_cache_hits,
+			stats->line_cache_misses)
+		&& sbuf_append(&sb, "line cache re-expanded: ", 24)
+		&& add_count(&sb, stats->line_cache_reexpand)
+		&& sbuf_addc(&sb, '\n'))
+		sbuf_flush(&sb, STDERR_FILENO);
+	sbuf_free(&sb);
+	stats->enabled = 0;
+}
@@ -15,7 +15,8 @@
 int	is_redirect_token(t_token_type type)
 {
 	return (type == T_REDIR_IN || type == T_REDIR_OUT \
-		|| type == T_APPEND || type == T_HEREDOC);
+		|| type == T_APPEND || type == T_HEREDOC || type == T_HERESTRING \
+		|| type == T_DUP_IN || type == T_DUP_OUT);
 }
 
 char	*ft_strncpy(char *dest, const char *src, size_t n)
@@ -67,4 +68,21 @@ char	*ft_strcat(char *dest, const char *src)
 	}
 	dest[i] = '\0';
 	return (dest);	
-}
\ No newline at end of file
+}
+
+//partial write가 나와도 전부 쓸 때까지 반복
+int	write_all(int fd, const char *buf, size_t len)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < len)
+	{
+		n = write(fd, buf + done, len - done);
+		if (n < 0)
+			return (0);
+		done += n;
+	}
+	return (1);
+}
@@ -22,12 +22,42 @@ int		is_redir_type(t_token_type type);
 int		is_valid_expand(t_exp *exp_data, char *value);
 
 char	*charjoin_and_free(char *s, char c);
+
+//sbuf.c, sbuf_io.c
+int		sbuf_init(t_sbuf *sb, size_t cap);
+int		sbuf_reserve(t_sbuf *sb, size_t n);
+int		sbuf_append(t_sbuf *sb, const char *s, size_t n);
+int		sbuf_addc(t_sbuf *sb, char c);
+int		sbuf_flush(t_sbuf *sb, int fd);
+void	sbuf_free(t_sbuf *sb);
+int		read_all(int fd, t_sbuf *sb);
+
+//셸이 내부적으로 들고 있는 fd는 이 번호 이상 (사용자의 3>file 등과 안겹치게)
+# define SHELL_FD_BASE 10
+
+int		move_fd_high(int fd);
+
+//match.c, match_compile.c
+# define MATCH_LONGEST 1
+# define MATCH_REVERSE 2
+
+int		pattern_compile(t_pattern *p, const char *pat);
+void	pattern_free(t_pattern *p);
+long	pattern_match_len(t_pattern *p, const char *s, size_t n, int flags);
+int		pattern_match(t_pattern *p, const char *s);
+int		pattern_literal(t_pattern *p, char **lit);
+
+unsigned long	hash_bytes(const char *s, size_t n);
+int		write_all(int fd, const char *buf, size_t len);
+void	report_stats(t_shell *shell);
+
 int	is_redirect_token(t_token_type type);
 char	*ft_strcpy(char *dest, const char *src);
 char	*ft_strncpy(char *dest, const char *src, size_t n);
 char	*ft_strcat(char *dest, const char *src);
 
 int init_shell(t_shell *shell);
+t_shell	*current_shell(t_shell *shell);
 t_envp	*create_env_node(char *env_str);
 void	add_env_node(t_envp **head, t_envp *new_node);
 char	**env_list_to_array(t_envp *envp_list);
@@ -0,0 +1,9 @@
+printf '%s\n' $((1/0)) > /dev/stderr
+printf '%s\n' $? > /dev/stderr
+printf '%s\n' "ran $((1 +))" > /dev/stderr
+printf '%s\n' "status $?" > /dev/stderr
+$((2 ** -1))
+printf '%s\n' "status $?" > /dev/stderr
+printf '%s\n' $((7 / 2)) > /dev/stderr
+export x=3*4
+printf '%s\n' $((x + 1)) $((x + 1)) > /dev/stderr
@@ -0,0 +1,32 @@
+a=(one "two words" three)
+printf '%s\n' "count ${#a[@]} second=${a[1]}" >&2
+printf '<%s>\n' "${a[@]}" >&2
+printf '<%s>\n' "${a[*]}" >&2
+a[5]=six
+printf '%s\n' "keys ${!a[@]}" >&2
+unset 'a[0]'
+printf '%s\n' "after unset ${#a[@]} ${a[@]}" >&2
+printf '%s\n' "sub ${a[@]/t/T}" >&2
+printf '%s\n' "strip ${a[@]%e*}" >&2
+empty=()
+printf '<%s>\n' start "${empty[@]}" end >&2
+declare -A color
+color[sky]=blue
+color[grass]=green
+printf '%s\n' "sky=${color[sky]} grass=${color[grass]} n=${#color[@]}" >&2
+i=2
+b=(x y z)
+printf '%s\n' "b[i]=${b[i]} b[i-1]=${b[$((i - 1))]}" >&2
+printf '%s\n' alpha beta gamma > /tmp/minishell_array_test
+mapfile -t lines < /tmp/minishell_array_test
+printf '%s\n' "lines ${#lines[@]} last=${lines[2]}" >&2
+readarray raw < /tmp/minishell_array_test
+printf '%s' "first raw ${raw[0]}" >&2
+mapfile -t piped <<EOF
+p1
+p2
+EOF
+printf '%s\n' "heredoc ${piped[@]}" >&2
+rm -f /tmp/minishell_array_test
+f() { printf '%s\n' "args $#" >&2; }
+f "${a[@]}"
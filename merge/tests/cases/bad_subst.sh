@@ -0,0 +1,5 @@
+printf '%s\n' "ran ${x!y}" > /dev/stderr
+printf '%s\n' "status $?" > /dev/stderr
+export x=${a[bad}
+printf '%s\n' "status $?" > /dev/stderr
+printf '%s\n' "${x:-ok}" > /dev/stderr
@@ -0,0 +1,11 @@
+printf '%s\n' a{b,c,d}e > /dev/stderr
+printf '%s ' {1..5} x{a..e} {5..1} > /dev/stderr
+printf '\n' > /dev/stderr
+printf '%s ' {01..10..3} {z..u..2} {0..-4..2} > /dev/stderr
+printf '\n' > /dev/stderr
+printf '%s ' {a,b{1..3},c}-{x,y} > /dev/stderr
+printf '\n' > /dev/stderr
+printf '%s\n' "{a,b}" '{1..3}' {a} {a,} {1..x} > /dev/stderr
+export V=z
+printf '%s\n' {$V,w}1 > /dev/stderr
+printf '%s\n' {1..70000} | wc -l > /dev/stderr
@@ -0,0 +1,17 @@
+$(exit 4)
+printf '%s\n' $? > /dev/stderr
+$(false)
+printf '%s\n' "false $?" > /dev/stderr
+export y=$(false)
+printf '%s\n' "export $?" > /dev/stderr
+printf '%s\n' "$(exit 3) $?" > /dev/stderr
+printf '%s\n' "$(echo hi) $?" > /dev/stderr
+printf '%s\n' "[$(exit 5)]" > /dev/stderr
+printf '%s\n' "$(printf 'a\n\n')" > /dev/stderr
+x=$(false)
+printf '%s\n' "assign $?" >&2
+y=$(exit 3)
+printf '%s\n' "assign $?" >&2
+false; z=$(true)
+printf '%s\n' "assign $?" >&2
+for i in 1; do $(exit 6); printf '%s\n' "loop $?" >&2; done
@@ -0,0 +1,26 @@
+for w in apple b.c x; do
+case $w in
+a*) printf '%s\n' "$w starts with a" >&2;;
+*.c|*.h) printf '%s\n' "$w is source" >&2;;
+*) printf '%s\n' "$w other" >&2
+esac
+done
+case "x y" in "x y") printf '%s\n' quoted >&2;; esac
+i=0
+while [ $i -lt 3 ]; do i=$((i + 1)); printf '%s\n' "while $i" >&2; done
+until [ $i -eq 0 ]; do i=$((i - 1)); done
+printf '%s\n' "until $i" >&2
+for a in 1 2; do
+for b in 1 2 3; do
+[ $b -eq 2 ] && continue 2
+printf '%s\n' "$a$b" >&2
+done
+done
+for a in 1 2; do
+while true; do break 2; done
+printf '%s\n' never >&2
+done
+printf '%s\n' "after $a" >&2
+if false; then printf no >&2; elif true; then printf '%s\n' elif >&2; else printf no >&2; fi
+{ printf '%s\n' group >&2; printf '%s\n' lines >&2; }
+(exit 7) || printf '%s\n' "sub $?" >&2
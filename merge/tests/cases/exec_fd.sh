@@ -0,0 +1,22 @@
+export D=$(mktemp -d)
+exec 3>$D/log
+echo one >&3
+echo two >&3
+printf 'three\n' 1>&3
+exec 3>&-
+echo four >&3
+cat $D/log >&2
+exec 4<$D/log
+cat <&4 >&2
+exec 4<&-
+echo to stderr 1>&2
+echo both > $D/b 2>&1
+cat $D/b >&2
+ls /no_such_dir_x 2> $D/err
+printf 'err lines %s\n' $(wc -l < $D/err) >&2
+echo append >> $D/log
+exec 5>>$D/log
+echo five >&5
+exec 5>&-
+cat $D/log 1>&2
+rm -rf $D
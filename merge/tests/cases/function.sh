@@ -0,0 +1,38 @@
+greet() { printf '%s\n' "hello $1 ($#)" >&2; }
+greet world
+greet a b c
+first() {
+printf '%s\n' "in first" >&2
+return 3
+printf '%s\n' never >&2
+}
+first
+printf '%s\n' "status $?" >&2
+setv() { export shared=$1; }
+setv inside
+printf '%s\n' "shared=$shared" >&2
+outer() { inner $1-x; printf '%s\n' "outer still $1" >&2; }
+inner() { printf '%s\n' "inner got $1" >&2; }
+outer arg
+loop() {
+for i in 1 2 3; do
+[ $i -eq 2 ] && return $i
+printf '%s\n' "loop $i" >&2
+done
+}
+loop
+printf '%s\n' "loop returned $?" >&2
+body() { cat <<EOF >&2
+arg=$1 count=$#
+EOF
+}
+body one
+body two three
+lit() { cat <<'EOF' >&2
+lit $1
+EOF
+}
+lit x
+greet() { printf '%s\n' "redefined $1" >&2; }
+greet again
+greet piped | cat
@@ -0,0 +1,15 @@
+export D=$(mktemp -d)
+cd $D
+touch b.c a.c c.h .hidden.c d1.c d22.c 'sp ace.c'
+printf '%s\n' *.c > /dev/stderr
+printf '%s\n' ?.h d?.c > /dev/stderr
+printf '%s\n' *[12].c > /dev/stderr
+printf '%s\n' "*.c" '*.c' \*.c > /dev/stderr
+printf '%s\n' *.none > /dev/stderr
+export P='?.h'
+printf '%s\n' $P "$P" > /dev/stderr
+mkdir sub
+touch sub/x.c sub/y.h
+printf '%s\n' */*.c s*/?.h > /dev/stderr
+cd /
+rm -rf $D
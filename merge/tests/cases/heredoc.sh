@@ -0,0 +1,40 @@
+export X=old
+cat <<EOF > /dev/stderr
+x=$X "$X" '$X'
+EOF
+cat <<A <<B > /dev/stderr
+first
+A
+second $X
+B
+cat << EOF > /dev/stderr
+  keeps  spaces
+EOF
+cat <<'EOF' > /dev/stderr
+quoted $X
+EOF
+cat <<E"O"F > /dev/stderr
+half $X "quoted"
+EOF
+cat <<A > /dev/stderr | cat <<B > /dev/null
+own body
+A
+other body
+B
+cat <<A | cat <<B > /dev/stderr
+not this
+A
+second command
+B
+cat <<EOF > /dev/stderr
+same body
+EOF
+cat <<EOF > /dev/stderr
+same body
+EOF
+cat <<EOF < /dev/null > /dev/stderr
+hidden
+EOF
+cat < /dev/null <<EOF > /dev/stderr
+last redirection wins
+EOF
@@ -0,0 +1,21 @@
+export x=old
+for i in 1 2; do cat <<EOF >&2; export x=new; done
+i=$i x=$x
+EOF
+export y=a; cat <<EOF >&2; export y=b; cat <<EOF >&2
+first $y
+EOF
+second $y
+EOF
+for j in 1; do cat >&2; done <<EOF
+got $x
+EOF
+for i in 1 2; do cat <<'EOF' >&2; done
+lit $i
+EOF
+for i in 1 2 3; do cat <<EOF | tr a-z A-Z >&2; done
+pipe $i
+EOF
+if true; then cat <<EOF >&2; fi
+in if $(printf 'sub')
+EOF
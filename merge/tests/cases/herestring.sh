@@ -0,0 +1,6 @@
+export X='a  b'
+cat <<< $X > /dev/stderr
+cat <<< "$X" > /dev/stderr
+cat <<< 'lit $X' > /dev/stderr
+wc -c <<< "" > /dev/stderr
+cat <<< first <<< second > /dev/stderr
@@ -0,0 +1,8 @@
+export X=a
+printf '%s\n' "x=$X" > /dev/stderr
+export X=b
+printf '%s\n' "x=$X" > /dev/stderr
+unset X
+printf '%s\n' "x=$X" > /dev/stderr
+printf '%s\n' same > /dev/stderr
+printf '%s\n' same > /dev/stderr
@@ -0,0 +1,8 @@
+cat <(printf 'a\n') <(printf 'b\n') > /dev/stderr
+printf 'to sub\n' | tee >(cat > /dev/stderr) > /dev/null
+diff <(printf 'x\n') <(printf 'y\n') > /dev/stderr
+printf '%s\n' "status $?" > /dev/stderr
+cat <(cat <(printf 'nested\n')) > /dev/stderr
+printf '%s\n' "$(cat <(printf 'inside cmdsub\n'))" > /dev/stderr
+cat <(printf 'dropped\n') ${x!y} > /dev/stderr
+printf '%s\n' "status $?" > /dev/stderr
@@ -0,0 +1,30 @@
+read a b <<EOF
+one two three four
+EOF
+printf '%s\n' "a=$a b=$b" >&2
+read -r line <<'EOF'
+back\slash  kept
+EOF
+printf '%s\n' "r=$line" >&2
+read esc <<'EOF'
+back\slash
+EOF
+printf '%s\n' "e=$esc" >&2
+IFS=: read x y z <<EOF
+p:q:r:s
+EOF
+printf '%s\n' "x=$x y=$y z=$z" >&2
+read -r lone <<EOF
+   trimmed
+EOF
+printf '%s\n' "[$lone]" >&2
+printf '%s\n' l1 l2 l3 > /tmp/minishell_read_test
+n=0
+while read -r l; do n=$((n + 1)); printf '%s\n' "$n:$l" >&2; done < /tmp/minishell_read_test
+rm -f /tmp/minishell_read_test
+read gone < /dev/null
+printf '%s\n' "eof $?" >&2
+printf 'no newline' > /tmp/minishell_read_test
+read -r part < /tmp/minishell_read_test
+printf '%s\n' "part=$part $?" >&2
+rm -f /tmp/minishell_read_test
@@ -0,0 +1,6 @@
+# 1000자 필드 4000개인 4MB 한 줄을 변수 4000개로 나눔
+# (필드마다 줄 끝까지 다시 세면 시간 초과)
+read $(seq -f v%g 4000) <<< "$(seq -f %01000g 4000 | tr '\n' ' ')"
+echo ${#v1} ${v3999//0/} >&2
+IFS=: read p q r <<< "x:y:z:w"
+echo "$p|$q|$r" >&2
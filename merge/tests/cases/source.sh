@@ -0,0 +1,15 @@
+export D=$(mktemp -d)
+printf 'export S=set_by_source\nprintf "%%s\\n" "in file $1 $2" >&2\n' > $D/a.sh
+source $D/a.sh x y
+printf '%s\n' "$S" >&2
+. $D/a.sh
+printf 'printf "%%s\\n" changed >&2\n' > $D/a.sh
+. $D/a.sh
+printf 'false\n' > $D/f.sh
+. $D/f.sh
+printf '%s\n' "status $?" >&2
+printf '. %s/a.sh\nprintf "%%s\\n" outer >&2\n' $D > $D/n.sh
+. $D/n.sh
+. ./no_such_source_x.sh
+printf '%s\n' "status $?" >&2
+rm -rf $D
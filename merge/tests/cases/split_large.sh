@@ -0,0 +1,20 @@
+export X=1
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+export X="$X $X"
+printf "%s\n" $X$X$X$X | wc -l > /dev/stderr
+export Y="  a  b  c "
+printf "[%s]" $Y > /dev/stderr
+printf "\n" > /dev/stderr
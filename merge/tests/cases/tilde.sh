@@ -0,0 +1,9 @@
+export HOME=/home/someone
+printf '%s\n' ~ ~/x "~" '~/x' x~ ~/"a b" > /dev/stderr
+export PWD=/p OLDPWD=/q
+printf '%s\n' ~+ ~+/y ~- > /dev/stderr
+printf '%s\n' ~root ~root/z ~no_such_user_x ~no_such_user_x > /dev/stderr
+export HOME=/other
+printf '%s\n' ~ > /dev/stderr
+export HOME='/a b'
+printf '%s\n' ~ > /dev/stderr
@@ -0,0 +1,23 @@
+#!/bin/bash
+# cases/*.sh를 minishell의 stdin으로 넣어 실행해서 stderr를 cases/*.expected와 비교
+# stdout에는 디버그 출력이 섞이므로 케이스는 확인할 값을 /dev/stderr로 냄
+# 케이스마다 10초 제한 (느려진 것도 실패로 잡음)
+
+cd "$(dirname "$0")" || exit 1
+MS=../minishell
+fail=0
+for t in cases/*.sh; do
+	name=${t%.sh}
+	out=$(cd cases && timeout 10 ../$MS < "${t#cases/}" 2>&1 >/dev/null)
+	if [ $? -eq 124 ]; then
+		echo "TIMEOUT $name"
+		fail=1
+	elif [ "$out" != "$(cat "$name.expected")" ]; then
+		echo "FAIL    $name"
+		diff <(echo "$out") "$name.expected"
+		fail=1
+	else
+		echo "ok      $name"
+	fi
+done
+exit $fail
@@ -15,6 +15,7 @@
 
 # include <unistd.h>
 # include <signal.h>
+# include <time.h>
 
 # define SUCCESS 0
 # define FAILURE 1
@@ -23,6 +24,13 @@
 # define SIG_NON_INTERACTIVE 0
 # define SIG_CHILD 2
 
+# define MASK_LITERAL 0
+# define MASK_UNQUOTED 1
+# define MASK_QUOTED 2
+# define MASK_BREAK 3
+# define MASK_VANISH 4
+# define SPECIAL_PARAMS "?#@*0123456789"
+
 extern volatile sig_atomic_t g_signal_received;
 
 typedef struct s_envp
@@ -40,9 +48,20 @@ typedef enum e_token_type
 	T_REDIR_OUT,
 	T_APPEND,
 	T_HEREDOC,
+	T_HERESTRING,
+	T_DUP_IN,
+	T_DUP_OUT,
+	T_SEMI,
+	T_AND,
+	T_OR,
+	T_DSEMI,
+	T_LPAREN,
+	T_RPAREN,
+	T_NEWLINE,
 	T_ERROR,
 	T_CORRECT_FILNAME,
 	T_WRONG_FILNAME,
+	T_BRACE,
 	T_END
 }	t_token_type;
 
@@ -50,6 +69,7 @@ typedef struct s_token
 {
 	t_token_type	type;
 	char			*value;
+	char			*mask;
 	struct s_token	*next;
 }	t_token;
 
@@ -60,11 +80,45 @@ typedef enum e_quote_state
 	STATE_IN_DQUOTE
 }	t_quote_state;
 
+typedef struct s_sbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}	t_sbuf;
+
+typedef enum e_atom_type
+{
+	ATOM_CHAR,
+	ATOM_ANY,
+	ATOM_STAR,
+	ATOM_CLASS
+}	t_atom_type;
+
+typedef struct s_atom
+{
+	t_atom_type	type;
+	char		c;
+	const char	*cls;
+	size_t		cls_len;
+	int			negate;
+}	t_atom;
+
+typedef struct s_pattern
+{
+	t_atom	*atoms;
+	size_t	count;
+	char	*cur;
+	char	*next;
+}	t_pattern;
+
 typedef struct s_exp
 {
 	t_quote_state	state;
 	size_t			idx;
-	char			*result;
+	t_sbuf			out;
+	t_sbuf			mask;
+	int				word;
 }	t_exp;
 
 typedef enum e_grammar_status
@@ -74,37 +128,199 @@ typedef enum e_grammar_status
 	GRAMMAR_EOF_ERROR,
 }	t_grammar_status;
 
+//raw가 있으면 실행할 때마다 확장할 원문 (fd는 마지막으로 만든 것)
 typedef struct s_hd
 {
 	int			fd;
+	char		*raw;
 	struct s_hd	*next;
 }	t_hd;
 
-typedef struct s_prompt
+//캐시 항목들이 맨 앞에 두는 공통 노드 (key는 항목이 소유)
+typedef struct s_lru
 {
-	char		*input;
-	t_envp		*envp_lst;
-	t_token		*token_lst;
-	t_hd		*hd_lst;
-}	t_prompt;
+	char			*key;
+	size_t			len;
+	unsigned long	hash;
+	struct s_lru	*next;
+}	t_lru;
 
-typedef struct s_filename
+typedef struct s_hd_cache
 {
-    char    *filename;
-    int     flag;
-	int		append_mode;
-	struct s_filename	*next;
-}   t_filename;
+	t_lru	lru;
+	int		fd;
+}	t_hd_cache;
+
+//io: 리다이렉션이 바꾸는 fd 번호 (2>file이면 2, 기본은 <가 0, >가 1)
+//saved: 셸 안에서 도는 빌트인용으로 바꾸기 전 fd를 복사해 둔 것
+typedef struct s_redir
+{
+	t_token_type	type;
+	char			*filename;
+	int				fd;
+	int				flag;
+	int				io;
+	int				saved;
+}	t_redir;
 
 typedef struct  s_cmd
 {
     char    **args;
-    t_filename    *input_file;
-    t_filename    *output_file;
-    int		hd;
-    struct s_cmd    *next;
+    int     argc;
+    int     arg_cap;
+    t_redir *redirs;
+    int     redir_count;
 }   t_cmd;
 
+typedef struct s_pipeline
+{
+	t_cmd	*cmds;
+	int		cmd_count;
+	t_redir	*redirs;
+	int		redir_count;
+}	t_pipeline;
+
+typedef struct s_line_cache
+{
+	t_lru			lru;
+	t_token			*raw;
+	int				has_var;
+	unsigned long	env_gen;
+	t_pipeline		*pl;
+}	t_line_cache;
+
+typedef struct s_stats
+{
+	int		enabled;
+	size_t	hd_cache_hits;
+	size_t	hd_cache_misses;
+	size_t	line_cache_hits;
+	size_t	line_cache_misses;
+	size_t	line_cache_reexpand;
+}	t_stats;
+
+typedef enum e_node_type
+{
+	N_CMD,
+	N_SEQ,
+	N_AND,
+	N_OR,
+	N_PIPE,
+	N_NOT,
+	N_IF,
+	N_WHILE,
+	N_UNTIL,
+	N_FOR,
+	N_CASE,
+	N_ITEM,
+	N_GROUP,
+	N_SUBSHELL,
+	N_FUNC
+}	t_node_type;
+
+//한 번만 파싱해 두는 복합 명령 트리 (실행할 때마다 확장만 다시 함)
+//words: CMD는 파이프까지 포함한 확장 전 토큰, FOR는 목록, CASE는 대상, ITEM은 패턴
+//left/right: 조건과 본문, 목록의 앞뒤, next: elif/else, 다음 case 항목
+//redirs: 복합 명령 뒤의 리다이렉션, hd_skip: 이 노드 앞에 있던 heredoc 수
+//FUNC는 name과 본문(left), 함수 표도 쥐고 있으면 refs, hd는 줄의 heredoc 복사본
+typedef struct s_node
+{
+	t_node_type		type;
+	t_token			*words;
+	t_token			*redirs;
+	char			*name;
+	int				has_in;
+	int				hd_skip;
+	int				redir_hd_skip;
+	int				refs;
+	t_hd			*hd;
+	struct s_node	*left;
+	struct s_node	*right;
+	struct s_node	*next;
+}	t_node;
+
+//함수 표의 항목 (같은 해시 칸끼리 next로 이음)
+typedef struct s_func
+{
+	unsigned long	hash;
+	t_node			*def;
+	struct s_func	*next;
+}	t_func;
+
+//함수 호출 한 겹, 돌아갈 때 되살릴 바깥 위치 인자와 반복문 깊이
+typedef struct s_frame
+{
+	char			**params;
+	int				param_count;
+	int				loop_depth;
+	struct s_frame	*prev;
+}	t_frame;
+
+//연관 배열의 원소 (같은 해시 칸끼리 next로 이음)
+typedef struct s_assoc
+{
+	char			*key;
+	char			*value;
+	unsigned long	hash;
+	struct s_assoc	*next;
+}	t_assoc;
+
+//배열 변수 (이름이 같은 해시 칸끼리 next로 이음)
+//첨자 배열은 vals[i]가 i번 원소, 빈 자리는 NULL, len은 마지막 원소 다음
+//연관 배열은 keys의 해시 칸마다 t_assoc 목록, count는 원소 수
+typedef struct s_array
+{
+	char			*name;
+	unsigned long	hash;
+	int				assoc;
+	char			**vals;
+	size_t			len;
+	size_t			cap;
+	t_assoc			**keys;
+	size_t			count;
+	struct s_array	*next;
+}	t_array;
+
+typedef struct s_prompt
+{
+	char			*input;
+	t_envp			*envp_lst;
+	t_token			*token_lst;
+	t_hd			*hd_lst;
+	t_pipeline		*pl;
+	t_line_cache	*line;
+	t_node			*ast;
+	struct s_shell	*shell;
+}	t_prompt;
+
+typedef struct s_procsub
+{
+	pid_t				pid;
+	int					fd;
+	struct s_procsub	*next;
+}	t_procsub;
+
+//-c 문자열, 스크립트 파일, tty가 아닌 stdin을 통째로 담아두는 버퍼
+//mapped면 mmap한 파일 (len만큼 munmap), 아니면 malloc한 버퍼
+//cut: 지금 줄 끝에 '\0'을 써넣은 자리 (여러 줄 명령이면 다음 줄까지 이어 붙임)
+typedef struct s_script
+{
+	char	*data;
+	size_t	len;
+	size_t	pos;
+	size_t	cut;
+	int		mapped;
+}	t_script;
+
+//source로 읽은 파일의 원본 내용 (경로, 수정 시각, 크기가 같으면 다시 안 읽음)
+typedef struct s_src_cache
+{
+	t_lru			lru;
+	struct timespec	mtime;
+	off_t			size;
+	char			*data;
+}	t_src_cache;
+
 typedef struct  s_shell
 {
     t_envp   *envp_list;
@@ -112,6 +328,28 @@ typedef struct  s_shell
     int     last_exit_status;
     int     exit_flag;
     int     signal_mode;
+    int     subst_status;
+    int     in_subst;
+    t_lru       *hd_cache;
+    t_lru       *line_cache;
+    t_lru       *arith_cache;
+    t_lru       *pw_cache;
+    unsigned long   env_gen;
+    t_stats     stats;
+    t_procsub   *procsubs;
+    t_script    *script;
+    char        **params;
+    int         param_count;
+    t_lru       *src_cache;
+    int         source_depth;
+    int         ast_depth;
+    int         loop_depth;
+    int         loop_break;
+    int         loop_continue;
+    t_func      **funcs;
+    t_frame     *frame;
+    int         returning;
+    t_array     **arrays;
 }   t_shell;
 
 #endif